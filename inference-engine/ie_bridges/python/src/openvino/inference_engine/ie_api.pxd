@@ -52,7 +52,8 @@ cdef class InferRequest:
     cpdef get_perf_counts(self)
     cdef void user_callback(self, int status) with gil
     cdef public:
-        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs
+        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs, \
+        _request_blobs, _zero_copy_inputs
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -65,6 +66,11 @@ cdef class ExecutableNetwork:
     cdef public:
         _requests, _infer_requests
 
+cdef class AsyncInferQueue:
+    cdef ExecutableNetwork _exec_net
+    cdef public:
+        _requests, _userdata, _callback
+
 cdef class IECore:
     cdef C.IECore impl
     cpdef IENetwork read_network(self, model : [str, bytes, os.PathLike], weights : [str, bytes, os.PathLike] = ?, bool init_from_buffer = ?)
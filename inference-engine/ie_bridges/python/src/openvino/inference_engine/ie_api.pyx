@@ -961,11 +961,19 @@ cdef class ExecutableNetwork:
     #                  If not specified, `timeout` value is set to -1 by default.
     #  @return Request status code: OK or RESULT_NOT_READY
     cpdef wait(self, num_requests=None, timeout=None):
+        cdef C.IEExecNetwork* impl = self.impl.get()
+        cdef int c_num_requests
+        cdef int64_t c_timeout
+        cdef int status
         if num_requests is None:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        c_num_requests = num_requests
+        c_timeout = timeout
+        with nogil:
+            status = impl.wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -982,6 +990,8 @@ cdef class InferRequest:
     #  which stores infer requests.
     def __init__(self):
         self._user_blobs = {}
+        self._request_blobs = {}
+        self._zero_copy_inputs = set()
         self._inputs_list = []
         self._outputs_list = []
         self._py_callback = lambda *args, **kwargs: None
@@ -1086,8 +1096,12 @@ cdef class InferRequest:
         else:
             deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
         self._user_blobs[blob_name] = blob
+        self._zero_copy_inputs.discard(blob_name)
     ## Starts synchronous inference of the infer request and fill outputs array
     #
+    #  \note The Python GIL is released while the inference runs. Inputs passed as C-contiguous `numpy.ndarray`
+    #  objects with the same shape and precision as the input blob are set to the request without copying.
+    #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
     #  @return None
@@ -1103,13 +1117,18 @@ cdef class InferRequest:
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
     cpdef infer(self, inputs=None):
+        cdef C.InferRequestWrap* impl = self.impl
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            impl.infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
+    #  \note Inputs passed as C-contiguous `numpy.ndarray` objects of the input shape and precision are not copied,
+    #  so they must not be modified until the request is completed.
+    #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
     #  @return: None
     #
@@ -1121,11 +1140,13 @@ cdef class InferRequest:
     #  res = exec_net.requests[0].output_blobs['prob']
     #  ```
     cpdef async_infer(self, inputs=None):
+        cdef C.InferRequestWrap* impl = self.impl
         if inputs is not None:
             self._fill_inputs(inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            impl.infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -1141,6 +1162,9 @@ cdef class InferRequest:
     #
     #  Usage example: See `async_infer()` method of the the `InferRequest` class.
     cpdef wait(self, timeout=None):
+        cdef C.InferRequestWrap* impl = self.impl
+        cdef int64_t c_timeout
+        cdef int status_code
         if self._py_callback_used:
             # check request status to avoid blocking for idle requests
             status = deref(self.impl).wait(WaitMode.STATUS_ONLY)
@@ -1159,7 +1183,10 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        c_timeout = timeout
+        with nogil:
+            status_code = impl.wait(c_timeout)
+        return status_code
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1250,11 +1277,133 @@ cdef class InferRequest:
     def _fill_inputs(self, inputs):
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
+            if self._set_zero_copy_input(k, v):
+                continue
+            self._restore_request_blob(k)
             if self.input_blobs[k].tensor_desc.precision == "FP16":
                 self.input_blobs[k].buffer[:] = v.view(dtype=np.int16)
             else:
                 self.input_blobs[k].buffer[:] = v
 
+    # Wraps the array memory into a blob and sets it to the request instead of copying the data.
+    # Returns False if the array cannot be shared with the request as is.
+    def _set_zero_copy_input(self, name, array):
+        cdef Blob blob
+        cdef Blob request_blob
+        if not isinstance(array, np.ndarray) or array.size == 0 or not array.flags['C_CONTIGUOUS'] or \
+                not array.flags['WRITEABLE']:
+            return False
+        # Blobs set by user via set_blob() can carry own preprocessing, data is copied to them
+        if name in self._user_blobs and name not in self._zero_copy_inputs:
+            return False
+        tensor_desc = self.input_blobs[name].tensor_desc
+        if tensor_desc.precision not in format_map or array.dtype != format_map[tensor_desc.precision] or \
+                tuple(array.shape) != tuple(tensor_desc.dims):
+            return False
+        if name not in self._request_blobs:
+            request_blob = Blob()
+            deref(self.impl).getBlobPtr(name.encode(), request_blob._ptr)
+            self._request_blobs[name] = request_blob
+        blob = Blob(tensor_desc, array)
+        deref(self.impl).setBlob(name.encode(), blob._ptr)
+        self._user_blobs[name] = blob
+        self._zero_copy_inputs.add(name)
+        return True
+
+    # Returns the blob allocated by the request back, so that copying the data does not overwrite user array
+    def _restore_request_blob(self, name):
+        cdef Blob request_blob
+        if name not in self._zero_copy_inputs:
+            return
+        request_blob = self._request_blobs[name]
+        deref(self.impl).setBlob(name.encode(), request_blob._ptr)
+        del self._user_blobs[name]
+        self._zero_copy_inputs.discard(name)
+
+
+## This class provides a pool of infer requests of an `ExecutableNetwork`. Each new inference is started on
+#  the first idle request of the pool and the user callback is called from the Inference Engine thread when
+#  the request is completed. The Python GIL is released while waiting for idle requests.
+cdef class AsyncInferQueue:
+    ## Class constructor
+    #  @param network: `ExecutableNetwork` which infer requests are used by the queue.
+    #                  Requests are used exclusively by the queue and have their completion callbacks overridden.
+    #  @return Instance of AsyncInferQueue class
+    #
+    #  Usage example:\n
+    #  ```python
+    #  ie_core = IECore()
+    #  net = ie_core.read_network(model=path_to_xml_file, weights=path_to_bin_file)
+    #  exec_net = ie_core.load_network(net, "CPU", num_requests=4)
+    #  results = {}
+    #  def callback(request, frame_id):
+    #      results[frame_id] = request.output_blobs['prob'].buffer.copy()
+    #  infer_queue = AsyncInferQueue(exec_net)
+    #  infer_queue.set_callback(callback)
+    #  for frame_id, image in enumerate(images):
+    #      infer_queue.start_async({'data': image}, frame_id)
+    #  infer_queue.wait_all()
+    #  ```
+    def __init__(self, ExecutableNetwork network):
+        self._exec_net = network
+        self._requests = network.requests
+        self._userdata = [None] * len(self._requests)
+        self._callback = None
+        for request_id, request in enumerate(self._requests):
+            request.set_completion_callback(self._request_completed, request_id)
+
+    def _request_completed(self, status, request_id):
+        if self._callback is not None:
+            self._callback(self._requests[request_id], self._userdata[request_id])
+
+    ## Sets a callback function that is called when any request of the queue is completed
+    #
+    #  @param callback: Function which accepts completed `InferRequest` and user data passed to `start_async()`
+    #  @return None
+    def set_callback(self, callback):
+        self._callback = callback
+
+    ## Starts asynchronous inference on the first idle request. Blocks until any request becomes idle.
+    #
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
+    #                 input data for the layer
+    #  @param userdata: Any data which is passed to the callback together with the request
+    #  @return Index of the request the inference has been started on
+    def start_async(self, inputs=None, userdata=None):
+        cdef C.IEExecNetwork* impl = self._exec_net.impl.get()
+        cdef int request_id
+        with nogil:
+            request_id = impl.acquireIdleRequestId(-1)
+        self._userdata[request_id] = userdata
+        try:
+            self._requests[request_id].async_infer(inputs)
+        except:
+            impl.releaseRequestId(request_id)
+            raise
+        return request_id
+
+    ## Waits until all requests of the queue are completed and their callbacks are finished
+    #  @return None
+    def wait_all(self):
+        cdef C.IEExecNetwork* impl = self._exec_net.impl.get()
+        cdef int num_requests = len(self._requests)
+        with nogil:
+            impl.wait(num_requests, -1)
+
+    ## Checks whether the next `start_async()` call does not block
+    #  @return True if there is at least one idle request in the queue
+    def is_ready(self):
+        return deref(self._exec_net.impl).getIdleRequestId() != -1
+
+    def __len__(self):
+        return len(self._requests)
+
+    def __getitem__(self, i):
+        return self._requests[i]
+
+    def __iter__(self):
+        return iter(self._requests)
+
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
 #  some model parameters such as layers affinity and output layers.
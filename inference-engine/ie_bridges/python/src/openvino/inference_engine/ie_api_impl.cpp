@@ -382,19 +382,24 @@ void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
 }
 
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
-    if (code != InferenceEngine::StatusCode::OK) {
-        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
-    }
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
+    if (code != InferenceEngine::StatusCode::OK) {
+        requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
+        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+    }
     auto end_time = Time::now();
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
-    requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
+    // The completion callback is the only place an asynchronous request is reported idle, and it is done only
+    // after the user callback has finished with the outputs. Wait() in the status only mode reports the request
+    // finished as soon as the plugin is done with it, i.e. possibly while this callback is still running,
+    // so a request pool could restart the request under the user callback if Wait() reported it idle too
     if (requestWrap->user_callback) {
         requestWrap->user_callback(requestWrap->user_data, code);
     }
+    requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
 }
 
 void InferenceEnginePython::InferRequestWrap::setCyCallback(cy_callback callback, void *data) {
@@ -421,9 +426,6 @@ void InferenceEnginePython::InferRequestWrap::infer_async() {
 int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
     InferenceEngine::ResponseDesc responseDesc;
     InferenceEngine::StatusCode code = request_ptr->Wait(timeout, &responseDesc);
-    if (code != InferenceEngine::RESULT_NOT_READY) {
-        request_queue_ptr->setRequestIdle(index);
-    }
     return static_cast<int>(code);
 }
 
@@ -485,6 +487,14 @@ int InferenceEnginePython::IEExecNetwork::getIdleRequestId() {
     return request_queue_ptr->getIdleRequestId();
 }
 
+int InferenceEnginePython::IEExecNetwork::acquireIdleRequestId(int64_t timeout) {
+    return request_queue_ptr->acquireIdleRequestId(timeout);
+}
+
+void InferenceEnginePython::IEExecNetwork::releaseRequestId(int index) {
+    request_queue_ptr->setRequestIdle(index);
+}
+
 int InferenceEnginePython::IdleInferRequestQueue::wait(int num_requests, int64_t timeout) {
     std::unique_lock<std::mutex> lock(mutex);
     if (timeout > 0) {
@@ -497,7 +507,10 @@ int InferenceEnginePython::IdleInferRequestQueue::wait(int num_requests, int64_t
 
 void InferenceEnginePython::IdleInferRequestQueue::setRequestIdle(int index) {
    std::unique_lock<std::mutex> lock(mutex);
-   idle_ids.emplace_back(index);
+   // A request may be reported idle more than once, e.g. released by the user after its completion, keep a single entry for it
+   if (std::find(idle_ids.begin(), idle_ids.end(), index) == idle_ids.end()) {
+       idle_ids.emplace_back(index);
+   }
    cv.notify_all();
 }
 
@@ -511,6 +524,21 @@ int InferenceEnginePython::IdleInferRequestQueue::getIdleRequestId() {
     return idle_ids.size() ? idle_ids.front() : -1;
 }
 
+int InferenceEnginePython::IdleInferRequestQueue::acquireIdleRequestId(int64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (timeout > 0) {
+        if (!cv.wait_for(lock, std::chrono::milliseconds(timeout), [this](){return !idle_ids.empty();}))
+            return -1;
+    } else if (timeout < 0) {
+        cv.wait(lock, [this](){return !idle_ids.empty();});
+    } else if (idle_ids.empty()) {
+        return -1;
+    }
+    int index = static_cast<int>(idle_ids.front());
+    idle_ids.pop_front();
+    return index;
+}
+
 void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests) {
     if (0 == num_requests) {
         num_requests = getOptimalNumberOfRequests(actual);
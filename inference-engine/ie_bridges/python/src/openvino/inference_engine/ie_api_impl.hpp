@@ -88,6 +88,8 @@ struct IdleInferRequestQueue {
 
     int getIdleRequestId();
 
+    int acquireIdleRequestId(int64_t timeout);
+
     using Ptr = std::shared_ptr<IdleInferRequestQueue>;
 };
 
@@ -148,6 +150,8 @@ struct IEExecNetwork {
 
     int wait(int num_requests, int64_t timeout);
     int getIdleRequestId();
+    int acquireIdleRequestId(int64_t timeout);
+    void releaseRequestId(int index);
 
     void createInferRequests(int num_requests);
 };
@@ -168,8 +168,10 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void exportNetwork(const string & model_file) except +
         object getMetric(const string & metric_name) except +
         object getConfig(const string & metric_name) except +
-        int wait(int num_requests, int64_t timeout)
+        int wait(int num_requests, int64_t timeout) nogil
         int getIdleRequestId()
+        int acquireIdleRequestId(int64_t timeout) nogil
+        void releaseRequestId(int index)
 
     cdef cppclass IENetwork:
         IENetwork() except +
@@ -202,9 +204,9 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void setBlob(const string &blob_name, const CBlob.Ptr &blob_ptr, CPreProcessInfo& info) except +
         void getPreProcess(const string& blob_name, const CPreProcessInfo** info) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() except + nogil
+        void infer_async() except + nogil
+        int wait(int64_t timeout) except + nogil
         void setBatch(int size) except +
         void setCyCallback(void (*)(void*, int), void *) except +
 
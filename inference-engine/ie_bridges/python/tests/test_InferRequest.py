@@ -17,6 +17,7 @@
 import numpy as np
 import os
 import pytest
+import sys
 import warnings
 import threading
 from datetime import datetime
@@ -528,3 +529,99 @@ def test_resize_algorithm_work(device):
     res_2 = np.sort(request.output_blobs['fc_out'].buffer)
 
     assert np.allclose(res_1, res_2, atol=1e-2, rtol=1e-2)
+
+
+def test_infer_zero_copy_inputs(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img})
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    # Non-contiguous input is copied to the blob allocated by the request, user array is kept intact
+    img_copy = img.copy()
+    img_fortran = np.asfortranarray(np.zeros_like(img))
+    request.infer({'data': img_fortran})
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    assert np.array_equal(img, img_copy)
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_async_infer_queue(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=4)
+    img = read_image()
+    results = {}
+
+    def callback(request, userdata):
+        results[userdata] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    infer_queue = ie.AsyncInferQueue(exec_net)
+    infer_queue.set_callback(callback)
+    assert len(infer_queue) == 4
+    for i in range(20):
+        infer_queue.start_async({'data': img}, i)
+    infer_queue.wait_all()
+    assert infer_queue.is_ready()
+    assert len(results) == 20
+    assert all(res == 2 for res in results.values())
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_infer_releases_gil(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    request = exec_net.requests[0]
+    request.input_blobs['data'].buffer[:] = read_image()
+    go = threading.Event()
+    progressed = threading.Event()
+
+    def run():
+        go.wait()
+        progressed.set()
+
+    thread = threading.Thread(target=run)
+    thread.start()
+    # The main thread doesn't give the GIL up on its own for a long time, so the other thread can only make
+    # progress while the main thread waits for the inference with the GIL released
+    switch_interval = sys.getswitchinterval()
+    sys.setswitchinterval(60)
+    try:
+        go.set()
+        for _ in range(100):
+            request.infer()
+            if progressed.is_set():
+                break
+        made_progress = progressed.is_set()
+    finally:
+        sys.setswitchinterval(switch_interval)
+    thread.join()
+    assert made_progress
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    del exec_net
+    del ie_core
+    del net
+
+
+def test_infer_read_only_input(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=1)
+    img = read_image()
+    read_only_img = np.frombuffer(img.tobytes(), dtype=img.dtype).reshape(img.shape)
+    assert not read_only_img.flags['WRITEABLE']
+    request = exec_net.requests[0]
+    request.infer({'data': read_only_img})
+    assert not np.shares_memory(request.input_blobs['data'].buffer, read_only_img)
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+    del exec_net
+    del ie_core
+    del net
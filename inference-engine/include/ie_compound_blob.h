@@ -311,4 +311,34 @@ class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
      */
     explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
 };
+
+/**
+ * @brief This class represents a blob that contains regions of interest of a single image - one per batch
+ * @details Underlying blobs are ROI blobs sharing the memory of the image, so unlike BatchedBlob they
+ * may have different sizes. The blob is supported as a network input with resize pre-processing only:
+ * every region is resized into its own batch slot of the network input in a single pre-processing pass.
+ */
+class INFERENCE_ENGINE_API_CLASS(BatchedROIBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the BatchedROIBlob object
+     */
+    using Ptr = std::shared_ptr<BatchedROIBlob>;
+
+    /**
+     * @brief A smart pointer to the const BatchedROIBlob object
+     */
+    using CPtr = std::shared_ptr<const BatchedROIBlob>;
+
+    /**
+     * @brief Constructs a batch of regions of interest of an image
+     * @details The image should be a MemoryBlob with NCHW or NHWC layout, an NV12Blob or an I420Blob,
+     * its batch dimension should be equal to 1. Resulting blob's tensor descriptor is the one of the image
+     * with batch dimension set to rois.size()
+     *
+     * @param image A blob the regions are taken from
+     * @param rois A vector of regions of interest, one per batch
+     */
+    BatchedROIBlob(const Blob::Ptr& image, const std::vector<ROI>& rois);
+};
 }  // namespace InferenceEngine
@@ -341,6 +341,31 @@ DECLARE_CONFIG_KEY(DEVICE_ID);
  */
 DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
 
+/**
+ * @brief The key defines the priority of inference tasks of the executable network.
+ *
+ * It is passed to Core::LoadNetwork() or ExecutableNetwork::SetConfig(), this option should be used with values:
+ * - MODEL_PRIORITY_HIGH tasks are dispatched before queued tasks of networks with lower priority
+ * - MODEL_PRIORITY_MED (default)
+ * - MODEL_PRIORITY_LOW tasks are dispatched only when there are no queued tasks of networks with higher priority
+ * Networks loaded with this key share the streams executor of the same streams configuration,
+ * so latency-critical networks are not queued behind bulk ones. Supported by the CPU plugin.
+ * ExecutableNetwork::SetConfig() accepts the key only for networks loaded with MODEL_PRIORITY or MODEL_DEADLINE.
+ */
+DECLARE_CONFIG_KEY(MODEL_PRIORITY);
+DECLARE_CONFIG_VALUE(MODEL_PRIORITY_HIGH);
+DECLARE_CONFIG_VALUE(MODEL_PRIORITY_MED);
+DECLARE_CONFIG_VALUE(MODEL_PRIORITY_LOW);
+
+/**
+ * @brief The key defines the deadline of inference tasks of the executable network in milliseconds.
+ *
+ * A task should be started within the deadline after it is queued, among the tasks of the same
+ * MODEL_PRIORITY the task with the earliest deadline is dispatched first.
+ * The value is a non-negative integer, 0 (default) means no deadline.
+ */
+DECLARE_CONFIG_KEY(MODEL_DEADLINE);
+
 /**
  * @brief This key enables dumping of the internal primitive graph.
  *
@@ -37,6 +37,16 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for target requests rate
+static const char qps_message[] = "Optional. Enable open-loop load generation: start inference requests at the given rate "
+                                  "(requests per second) regardless of completion of the previous ones. "
+                                  "Latency is measured from the scheduled start time, so queuing delay is included. "
+                                  "Requires async API. Default value is 0 (closed-loop).";
+
+/// @brief message for requests arrival distribution
+static const char arrival_message[] = "Optional. Distribution of requests arrival times in open-loop mode: "
+                                      "\"constant\" (default) or \"poisson\".";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -147,6 +157,12 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Target requests rate for open-loop mode
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Requests arrival distribution for open-loop mode
+DEFINE_string(arrival, "constant", arrival_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -217,6 +233,8 @@ static void showUsage() {
     std::cout << "    -niter \"<integer>\"        " << iterations_count_message << std::endl;
     std::cout << "    -nireq \"<integer>\"        " << infer_requests_count_message << std::endl;
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << "    -arrival \"<type>\"         " << arrival_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
@@ -37,11 +37,18 @@ public:
         _request.SetCompletionCallback(
                 [&]() {
                     _endTime = Time::now();
-                    _callbackQueue(_id, getExecutionTimeInMilliseconds());
+                    _callbackQueue(_id, getLatencyInMilliseconds());
                 });
     }
 
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request which was planned to start at scheduledTime.
+    /// The latency is measured from the scheduled time, so the time the request waits for an idle slot is included.
+    void startAsync(const Time::time_point& scheduledTime) {
+        _scheduledTime = scheduledTime;
         _startTime = Time::now();
         _request.StartAsync();
     }
@@ -52,9 +59,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _scheduledTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, getLatencyInMilliseconds());
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -70,8 +78,18 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getLatencyInMilliseconds() const {
+        auto latency = std::chrono::duration_cast<ns>(_endTime - _scheduledTime);
+        return static_cast<double>(latency.count()) * 0.000001;
+    }
+
+    Time::time_point getScheduledTime() const { return _scheduledTime; }
+    Time::time_point getStartTime() const { return _startTime; }
+    Time::time_point getEndTime() const { return _endTime; }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _scheduledTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -102,6 +120,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _timeline.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -112,6 +131,8 @@ public:
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        const auto& request = requests.at(id);
+        _timeline.push_back({id, request->getScheduledTime(), request->getStartTime(), request->getEndTime()});
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -135,13 +156,38 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns timings of all completed requests in milliseconds relative to the first scheduled request
+    std::vector<StatisticsReport::RequestTimeline> getTimeline() {
+        std::vector<StatisticsReport::RequestTimeline> timeline;
+        if (_timeline.empty())
+            return timeline;
+        auto origin = std::min_element(_timeline.begin(), _timeline.end(),
+                                       [] (const TimePoints& a, const TimePoints& b) { return a.scheduled < b.scheduled; })->scheduled;
+        auto toMilliseconds = [origin] (const Time::time_point& t) {
+            return std::chrono::duration_cast<ns>(t - origin).count() * 0.000001;
+        };
+        timeline.reserve(_timeline.size());
+        for (auto& t : _timeline) {
+            timeline.push_back({t.id, toMilliseconds(t.scheduled), toMilliseconds(t.start), toMilliseconds(t.end)});
+        }
+        return timeline;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
+    struct TimePoints {
+        size_t id;
+        Time::time_point scheduled;
+        Time::time_point start;
+        Time::time_point end;
+    };
+
     std::queue<size_t>_idleIds;
     std::mutex _mutex;
     std::condition_variable _cv;
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<TimePoints> _timeline;
 };
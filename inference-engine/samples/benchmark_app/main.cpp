@@ -9,6 +9,8 @@
 #include <string>
 #include <vector>
 #include <utility>
+#include <random>
+#include <thread>
 
 #include <inference_engine.hpp>
 #include <vpu/vpu_plugin_config.hpp>
@@ -56,6 +58,18 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_qps < 0.0) {
+        throw std::logic_error("Incorrect requests rate. Please set -qps option to a non-negative value.");
+    }
+
+    if (FLAGS_qps > 0.0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-qps option) is supported for async API only.");
+    }
+
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `constant` or `poisson` value.");
+    }
+
     if (!FLAGS_report_type.empty() &&
         FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
@@ -94,15 +108,6 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
-}
-
 /**
 * @brief The entry point of the benchmark application
 */
@@ -441,9 +446,11 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        const bool openLoop = FLAGS_qps > 0.0;
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1)/nireq)*nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from "
@@ -474,6 +481,13 @@ int main(int argc, char *argv[]) {
                                               {"number of parallel infer requests", std::to_string(nireq)},
                                               {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                  {"target requests rate (qps)", double_to_string(FLAGS_qps)},
+                                                  {"arrival distribution", FLAGS_arrival},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -502,6 +516,9 @@ int main(int argc, char *argv[]) {
                 ss << ", ";
             }
             ss << nireq << " inference requests";
+            if (openLoop) {
+                ss << " at " << double_to_string(FLAGS_qps) << " qps with " << FLAGS_arrival << " arrivals";
+            }
             std::stringstream device_ss;
             for (auto& nstreams : device_nstreams) {
                 if (!device_ss.str().empty()) {
@@ -555,9 +572,22 @@ int main(int argc, char *argv[]) {
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
+        // In open-loop mode requests are started by the schedule rather than by completion of the previous ones.
+        // The schedule is not shifted when all requests are busy, so the waiting time is accounted in the latency.
+        std::mt19937 arrivalGenerator;
+        std::exponential_distribution<double> poissonIntervals(openLoop ? FLAGS_qps : 1.0);
+        auto nextArrivalInterval = [&] () {
+            double seconds = FLAGS_arrival == "poisson" ? poissonIntervals(arrivalGenerator) : 1.0 / FLAGS_qps;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+        auto scheduledTime = startTime;
+
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                std::this_thread::sleep_until(scheduledTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -572,7 +602,12 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(scheduledTime);
+                    scheduledTime += nextArrivalInterval();
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -594,7 +629,8 @@ int main(int argc, char *argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        LatencyMetrics latencyMetrics(inferRequestsQueue.getLatencies());
+        double latency = latencyMetrics.median;
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
@@ -609,6 +645,10 @@ int main(int argc, char *argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
+                                                  {"latency p90 (ms)", double_to_string(latencyMetrics.p90)},
+                                                  {"latency p99 (ms)", double_to_string(latencyMetrics.p99)},
+                                                  {"latency p99.9 (ms)", double_to_string(latencyMetrics.p999)},
+                                                  {"latency max (ms)", double_to_string(latencyMetrics.max)},
                                           });
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -654,13 +694,20 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        if (statistics)
+        if (statistics) {
+            statistics->dumpLatencies(inferRequestsQueue.getLatencies(), inferRequestsQueue.getTimeline());
             statistics->dump();
+        }
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "    p90:    " << double_to_string(latencyMetrics.p90) << " ms" << std::endl;
+            std::cout << "    p99:    " << double_to_string(latencyMetrics.p99) << " ms" << std::endl;
+            std::cout << "    p99.9:  " << double_to_string(latencyMetrics.p999) << " ms" << std::endl;
+            std::cout << "    max:    " << double_to_string(latencyMetrics.max) << " ms" << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -7,9 +7,35 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 
 #include "statistics_report.hpp"
 
+// number of logarithmic latency histogram buckets between min and max latency
+static const size_t latencyHistogramBuckets = 32;
+
+LatencyMetrics::LatencyMetrics(const std::vector<double>& latencies) {
+    if (latencies.empty())
+        return;
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    min = sorted.front();
+    max = sorted.back();
+    avg = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    median = (sorted.size() % 2 != 0) ?
+             sorted[sorted.size() / 2ULL] :
+             (sorted[sorted.size() / 2ULL] + sorted[sorted.size() / 2ULL - 1ULL]) / 2.0;
+    p90 = percentile(sorted, 90.0);
+    p99 = percentile(sorted, 99.0);
+    p999 = percentile(sorted, 99.9);
+}
+
+double LatencyMetrics::percentile(const std::vector<double>& sorted, double p) {
+    auto rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+    return sorted[std::min(std::max(rank, static_cast<size_t>(1)), sorted.size()) - 1];
+}
+
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -132,3 +158,53 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpLatencies(const std::vector<double> &latencies, const std::vector<RequestTimeline> &timeline) {
+    if (latencies.empty()) {
+        slog::info << "Latencies were not collected. No latency report is dumped." << slog::endl;
+        return;
+    }
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_latency_report.csv");
+
+    LatencyMetrics metrics(latencies);
+    dumper << "Latency percentiles";
+    dumper.endLine();
+    dumper << "min (ms)" << "avg (ms)" << "median (ms)" << "p90 (ms)" << "p99 (ms)" << "p99.9 (ms)" << "max (ms)";
+    dumper.endLine();
+    dumper << metrics.min << metrics.avg << metrics.median << metrics.p90 << metrics.p99 << metrics.p999 << metrics.max;
+    dumper.endLine();
+    dumper.endLine();
+
+    // logarithmic buckets keep the resolution for the tail when latencies span several orders of magnitude
+    dumper << "Latency histogram";
+    dumper.endLine();
+    dumper << "lower bound (ms)" << "upper bound (ms)" << "count";
+    dumper.endLine();
+    const double lower = std::max(metrics.min, 1e-6);
+    const double ratio = std::max(metrics.max / lower, 1.0);
+    std::vector<size_t> histogram(latencyHistogramBuckets, 0);
+    for (auto latency : latencies) {
+        size_t bucket = 0;
+        if (ratio > 1.0 && latency > lower) {
+            bucket = static_cast<size_t>(std::log(latency / lower) / std::log(ratio) * latencyHistogramBuckets);
+        }
+        histogram[std::min(bucket, latencyHistogramBuckets - 1)]++;
+    }
+    for (size_t i = 0; i < latencyHistogramBuckets; i++) {
+        dumper << lower * std::pow(ratio, static_cast<double>(i) / latencyHistogramBuckets)
+               << lower * std::pow(ratio, static_cast<double>(i + 1) / latencyHistogramBuckets)
+               << histogram[i];
+        dumper.endLine();
+    }
+    dumper.endLine();
+
+    dumper << "Requests timeline";
+    dumper.endLine();
+    dumper << "request id" << "scheduled (ms)" << "started (ms)" << "finished (ms)" << "latency (ms)";
+    dumper.endLine();
+    for (auto& t : timeline) {
+        dumper << t.requestId << t.scheduled << t.started << t.finished << t.finished - t.scheduled;
+        dumper.endLine();
+    }
+    slog::info << "Latency report is stored to " << dumper.getFilename() << slog::endl;
+}
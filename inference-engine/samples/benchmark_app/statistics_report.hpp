@@ -19,12 +19,38 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
+/// @brief Latency percentiles over all measured inference requests, in milliseconds
+struct LatencyMetrics {
+    LatencyMetrics() = default;
+    explicit LatencyMetrics(const std::vector<double>& latencies);
+
+    double min = 0.0;
+    double avg = 0.0;
+    double median = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double max = 0.0;
+
+private:
+    // nearest-rank percentile of the sorted values
+    static double percentile(const std::vector<double>& sorted, double p);
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
     typedef std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> PerformaceCounters;
     typedef std::vector<std::pair<std::string, std::string>> Parameters;
 
+    /// @brief Timings of a single inference, in milliseconds from the start of measurements
+    struct RequestTimeline {
+        size_t requestId;
+        double scheduled;
+        double started;
+        double finished;
+    };
+
     struct Config {
         std::string report_type;
         std::string report_folder;
@@ -57,6 +83,8 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    void dumpLatencies(const std::vector<double> &latencies, const std::vector<RequestTimeline> &timeline);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
@@ -0,0 +1,315 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+#include <samples/args_helper.hpp>
+#include <samples/csv_dumper.hpp>
+
+#include "multi_model_benchmark.hpp"
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "statistics_report.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+/// @brief Settings of a single model taken from the comma-separated command line lists
+struct ModelSettings {
+    std::string path;
+    std::string device;
+    std::string inputs;
+    std::string nstreams;
+    std::string nthreads;
+    uint32_t nireq = 0;
+    uint32_t batch = 0;
+    double qps = 0.0;
+};
+
+/// @brief A model loaded to its device together with the infer requests driving it
+struct ModelRunner {
+    using Ptr = std::shared_ptr<ModelRunner>;
+
+    ModelSettings settings;
+    std::string name;
+    ExecutableNetwork network;
+    size_t batchSize = 1;
+    size_t iterations = 0;
+    std::unique_ptr<InferRequestsQueue> requestsQueue;
+
+    /// @brief Keeps the model busy (closed loop) or starts requests at the target rate (open loop) until the deadline
+    void run(const Time::time_point& startTime, const Time::time_point& endTime, bool poissonArrivals) {
+        const bool openLoop = settings.qps > 0.0;
+        std::mt19937 arrivalGenerator(std::hash<std::string>()(settings.path));
+        std::exponential_distribution<double> poissonIntervals(openLoop ? settings.qps : 1.0);
+        auto scheduledTime = startTime;
+        while (Time::now() < endTime) {
+            if (openLoop) {
+                if (scheduledTime >= endTime)
+                    break;
+                std::this_thread::sleep_until(scheduledTime);
+            }
+            auto inferRequest = requestsQueue->getIdleRequest();
+            // rethrows the error of the previous execution of the request, if any
+            inferRequest->wait();
+            if (openLoop) {
+                inferRequest->startAsync(scheduledTime);
+                double seconds = poissonArrivals ? poissonIntervals(arrivalGenerator) : 1.0 / settings.qps;
+                scheduledTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+            } else {
+                inferRequest->startAsync();
+            }
+            iterations++;
+        }
+        requestsQueue->waitAll();
+    }
+};
+
+std::string double_to_string(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+/// @brief Returns the value for the model with the given index: a single value is applied to all the models
+std::string getModelValue(const std::vector<std::string>& values, size_t index, size_t modelsCount,
+                          const std::string& option, const std::string& defaultValue = "") {
+    if (values.empty())
+        return defaultValue;
+    if (values.size() == 1)
+        return values.front();
+    if (values.size() != modelsCount)
+        throw std::logic_error("Number of values for -" + option + " option should be 1 or equal to the number of models");
+    return values.at(index);
+}
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    slog::info << "Parsing input parameters" << slog::endl;
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_help || FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        showUsage();
+        throw std::logic_error("Models are required but not set. Please set -m option.");
+    }
+
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `constant` or `poisson` value.");
+    }
+
+    if (FLAGS_t == 0) {
+        throw std::logic_error("Incorrect duration. Please set -t option to a positive value.");
+    }
+
+    return true;
+}
+
+std::vector<ModelSettings> parseModelsSettings() {
+    auto models = split(FLAGS_m, ',');
+    auto inputs = split(FLAGS_i, ',');
+    auto devices = split(FLAGS_d, ',');
+    auto nstreams = split(FLAGS_nstreams, ',');
+    auto nthreads = split(FLAGS_nthreads, ',');
+    auto nireq = split(FLAGS_nireq, ',');
+    auto batch = split(FLAGS_b, ',');
+    auto qps = split(FLAGS_qps, ',');
+
+    std::vector<ModelSettings> settings(models.size());
+    for (size_t i = 0; i < models.size(); i++) {
+        settings[i].path = models[i];
+        settings[i].inputs = getModelValue(inputs, i, models.size(), "i");
+        settings[i].device = getModelValue(devices, i, models.size(), "d", "CPU");
+        settings[i].nstreams = getModelValue(nstreams, i, models.size(), "nstreams");
+        settings[i].nthreads = getModelValue(nthreads, i, models.size(), "nthreads");
+        settings[i].nireq = std::stoul(getModelValue(nireq, i, models.size(), "nireq", "0"));
+        settings[i].batch = std::stoul(getModelValue(batch, i, models.size(), "b", "0"));
+        settings[i].qps = std::stod(getModelValue(qps, i, models.size(), "qps", "0"));
+        if (settings[i].qps < 0.0)
+            throw std::logic_error("Incorrect requests rate for model " + models[i] + ". It should be a non-negative value.");
+    }
+    return settings;
+}
+
+std::map<std::string, std::string> getLoadConfig(const ModelSettings& settings) {
+    std::map<std::string, std::string> config;
+    if (settings.device == "CPU") {
+        config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = settings.nstreams.empty() ?
+            std::string(CONFIG_VALUE(CPU_THROUGHPUT_AUTO)) : settings.nstreams;
+        if (!settings.nthreads.empty())
+            config[CONFIG_KEY(CPU_THREADS_NUM)] = settings.nthreads;
+        if (FLAGS_pin == "NUMA")
+            config[CONFIG_KEY(CPU_BIND_THREAD)] = CONFIG_VALUE(NUMA);
+        else
+            config[CONFIG_KEY(CPU_BIND_THREAD)] = FLAGS_pin == "NO" ? CONFIG_VALUE(NO) : CONFIG_VALUE(YES);
+    } else if (settings.device == "GPU") {
+        config[CONFIG_KEY(GPU_THROUGHPUT_STREAMS)] = settings.nstreams.empty() ?
+            std::string(CONFIG_VALUE(GPU_THROUGHPUT_AUTO)) : settings.nstreams;
+    } else if (!settings.nstreams.empty() || !settings.nthreads.empty()) {
+        slog::warn << "Number of streams and threads are ignored for device " << settings.device << slog::endl;
+    }
+    return config;
+}
+
+ModelRunner::Ptr loadModel(Core& ie, const ModelSettings& settings) {
+    auto runner = std::make_shared<ModelRunner>();
+    runner->settings = settings;
+
+    slog::info << "Loading model " << settings.path << " to " << settings.device << slog::endl;
+    CNNNetwork cnnNetwork = ie.ReadNetwork(settings.path);
+    runner->name = cnnNetwork.getName();
+    InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
+    if (inputInfo.empty()) {
+        throw std::logic_error("no inputs info is provided for model " + settings.path);
+    }
+
+    bool reshape = false;
+    auto appInputsInfo = getInputsInfo<InputInfo::Ptr>("", "", settings.batch, inputInfo, reshape);
+    if (reshape) {
+        ICNNNetwork::InputShapes shapes = {};
+        for (auto& item : appInputsInfo)
+            shapes[item.first] = item.second.shape;
+        slog::info << "Reshaping network: " << getShapesString(shapes) << slog::endl;
+        cnnNetwork.reshape(shapes);
+    }
+    runner->batchSize = cnnNetwork.getBatchSize();
+    for (auto& item : inputInfo) {
+        if (appInputsInfo.at(item.first).isImage()) {
+            appInputsInfo.at(item.first).precision = Precision::U8;
+            item.second->setPrecision(appInputsInfo.at(item.first).precision);
+        }
+    }
+
+    runner->network = ie.LoadNetwork(cnnNetwork, settings.device, getLoadConfig(settings));
+
+    uint32_t nireq = settings.nireq;
+    if (nireq == 0) {
+        try {
+            nireq = runner->network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const details::InferenceEngineException& ex) {
+            THROW_IE_EXCEPTION << "Every device used with the multi_model_benchmark should "
+                               << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                               << "Failed to query the metric for the " << settings.device << " with error:" << ex.what();
+        }
+    }
+    runner->requestsQueue.reset(new InferRequestsQueue(runner->network, nireq));
+
+    std::vector<std::string> inputFiles;
+    if (!settings.inputs.empty())
+        readInputFilesArguments(inputFiles, settings.inputs);
+    fillBlobs(inputFiles, runner->batchSize, appInputsInfo, runner->requestsQueue->requests);
+    return runner;
+}
+
+}  // namespace
+
+/**
+* @brief The entry point of the multi-model co-location benchmark application
+*/
+int main(int argc, char *argv[]) {
+    try {
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+        auto modelsSettings = parseModelsSettings();
+
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+        Core ie;
+
+        std::vector<ModelRunner::Ptr> runners;
+        for (auto& settings : modelsSettings) {
+            runners.push_back(loadModel(ie, settings));
+        }
+
+        // warming up each model separately - out of scope
+        for (auto& runner : runners) {
+            auto inferRequest = runner->requestsQueue->getIdleRequest();
+            inferRequest->startAsync();
+            runner->requestsQueue->waitAll();
+            runner->requestsQueue->resetTimes();
+        }
+
+        slog::info << "Running " << runners.size() << " models concurrently for " << FLAGS_t << " seconds" << slog::endl;
+        const bool poissonArrivals = FLAGS_arrival == "poisson";
+        const auto startTime = Time::now();
+        const auto endTime = startTime + std::chrono::seconds(FLAGS_t);
+        std::vector<std::thread> drivers;
+        std::vector<std::exception_ptr> errors(runners.size());
+        for (size_t i = 0; i < runners.size(); i++) {
+            drivers.emplace_back([&, i] {
+                try {
+                    runners[i]->run(startTime, endTime, poissonArrivals);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        for (auto& driver : drivers) {
+            driver.join();
+        }
+        for (auto& error : errors) {
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        std::unique_ptr<CsvDumper> dumper;
+        if (!FLAGS_report_folder.empty()) {
+            dumper.reset(new CsvDumper(true, FLAGS_report_folder + "/multi_model_benchmark_report.csv"));
+            *dumper << "model" << "device" << "infer requests" << "target rate (qps)" << "iterations"
+                    << "throughput (FPS)" << "median (ms)" << "p90 (ms)" << "p99 (ms)" << "p99.9 (ms)" << "max (ms)";
+            dumper->endLine();
+        }
+
+        for (auto& runner : runners) {
+            LatencyMetrics latency(runner->requestsQueue->getLatencies());
+            double duration = runner->requestsQueue->getDurationInMilliseconds();
+            double fps = runner->batchSize * 1000.0 * runner->iterations / duration;
+
+            std::cout << std::endl << "Model:      " << runner->name << " (" << runner->settings.path << ") on "
+                      << runner->settings.device << ", " << runner->requestsQueue->requests.size() << " infer requests";
+            if (runner->settings.qps > 0.0)
+                std::cout << ", target rate " << double_to_string(runner->settings.qps) << " qps";
+            std::cout << std::endl;
+            std::cout << "Count:      " << runner->iterations << " iterations" << std::endl;
+            std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+            std::cout << "Latency:    " << double_to_string(latency.median) << " ms" << std::endl;
+            std::cout << "    p90:    " << double_to_string(latency.p90) << " ms" << std::endl;
+            std::cout << "    p99:    " << double_to_string(latency.p99) << " ms" << std::endl;
+            std::cout << "    p99.9:  " << double_to_string(latency.p999) << " ms" << std::endl;
+            std::cout << "    max:    " << double_to_string(latency.max) << " ms" << std::endl;
+
+            if (dumper) {
+                *dumper << runner->settings.path << runner->settings.device << runner->requestsQueue->requests.size()
+                        << runner->settings.qps << runner->iterations << fps
+                        << latency.median << latency.p90 << latency.p99 << latency.p999 << latency.max;
+                dumper->endLine();
+            }
+        }
+        if (dumper) {
+            slog::info << "Report is stored to " << dumper->getFilename() << slog::endl;
+        }
+    } catch (const std::exception& ex) {
+        slog::err << ex.what() << slog::endl;
+        return 3;
+    }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message";
+
+/// @brief message for models argument
+static const char models_message[] = "Required. Comma-separated list of paths to .xml/.onnx files with trained models. "
+                                     "All the models are loaded and run concurrently.";
+
+/// @brief message for inputs argument
+static const char inputs_message[] = "Optional. Comma-separated list of paths to images and/or binaries, one per model. "
+                                     "Inputs are filled with random values if not specified.";
+
+/// @brief message for devices argument
+static const char devices_message[] = "Optional. Comma-separated list of target devices, one per model. Default value is CPU.";
+
+/// @brief message for #streams argument
+static const char nstreams_message[] = "Optional. Comma-separated list of numbers of streams for the CPU or GPU devices, one per model. "
+                                       "Default value is determined automatically for a device.";
+
+/// @brief message for #threads argument
+static const char nthreads_message[] = "Optional. Comma-separated list of numbers of CPU threads, one per model.";
+
+/// @brief message for #requests argument
+static const char nireq_message[] = "Optional. Comma-separated list of numbers of infer requests, one per model. "
+                                    "Default value is determined automatically for a device.";
+
+/// @brief message for target requests rate argument
+static const char qps_message[] = "Optional. Comma-separated list of target requests rates (requests per second), one per model. "
+                                  "0 runs the model in closed loop keeping all its infer requests busy. Default value is 0.";
+
+/// @brief message for requests arrival distribution
+static const char arrival_message[] = "Optional. Distribution of requests arrival times for models with non-zero rate: "
+                                      "\"constant\" (default) or \"poisson\".";
+
+/// @brief message for batch argument
+static const char batch_size_message[] = "Optional. Comma-separated list of batch sizes, one per model. "
+                                         "If not specified, the batch size value is determined from the model.";
+
+/// @brief message for execution time
+static const char execution_time_message[] = "Optional. Time in seconds to run the models concurrently. Default value is 60.";
+
+// @brief message for CPU threads pinning option
+static const char infer_threads_pinning_message[] = "Optional. Enable threads->cores (\"YES\", default), threads->(NUMA)nodes (\"NUMA\") "
+                                                    "or completely disable (\"NO\") CPU threads pinning for CPU-involved inference.";
+
+// @brief message for report_folder option
+static const char report_folder_message[] = "Optional. Path to a folder where the report with per-model results is stored.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief Define parameter for models files <br>
+/// It is a required parameter
+DEFINE_string(m, "", models_message);
+
+/// @brief Define parameter for inputs files
+DEFINE_string(i, "", inputs_message);
+
+/// @brief Define parameter for target devices
+DEFINE_string(d, "CPU", devices_message);
+
+/// @brief Number of streams per model
+DEFINE_string(nstreams, "", nstreams_message);
+
+/// @brief Number of CPU threads per model
+DEFINE_string(nthreads, "", nthreads_message);
+
+/// @brief Number of infer requests per model
+DEFINE_string(nireq, "", nireq_message);
+
+/// @brief Target requests rate per model
+DEFINE_string(qps, "", qps_message);
+
+/// @brief Requests arrival distribution for models with non-zero rate
+DEFINE_string(arrival, "constant", arrival_message);
+
+/// @brief Batch size per model
+DEFINE_string(b, "", batch_size_message);
+
+/// @brief Time to run the models in seconds
+DEFINE_uint32(t, 60, execution_time_message);
+
+// @brief CPU threads pinning
+DEFINE_string(pin, "YES", infer_threads_pinning_message);
+
+/// @brief Path to a folder where the report is stored
+DEFINE_string(report_folder, "", report_folder_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "multi_model_benchmark [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h, --help                " << help_message << std::endl;
+    std::cout << "    -m \"<paths>\"              " << models_message << std::endl;
+    std::cout << "    -i \"<paths>\"              " << inputs_message << std::endl;
+    std::cout << "    -d \"<devices>\"            " << devices_message << std::endl;
+    std::cout << "    -nireq \"<integers>\"       " << nireq_message << std::endl;
+    std::cout << "    -b \"<integers>\"           " << batch_size_message << std::endl;
+    std::cout << "    -qps \"<floats>\"           " << qps_message << std::endl;
+    std::cout << "    -arrival \"<type>\"         " << arrival_message << std::endl;
+    std::cout << "    -t                        " << execution_time_message << std::endl;
+    std::cout << std::endl << "  device-specific performance options:" << std::endl;
+    std::cout << "    -nstreams \"<integers>\"    " << nstreams_message << std::endl;
+    std::cout << "    -nthreads \"<integers>\"    " << nthreads_message << std::endl;
+    std::cout << "    -pin \"YES\"/\"NO\"/\"NUMA\"    " << infer_threads_pinning_message << std::endl;
+    std::cout << std::endl << "  Statistics dumping options:" << std::endl;
+    std::cout << "    -report_folder            " << report_folder_message << std::endl;
+}
@@ -65,3 +65,32 @@ std::vector<intel_dnn_component_t> DnnComponents::getExecutionOrder() {
     }
     return result;
 }
+
+std::vector<memory::MemUsage> DnnComponents::getMemoryUsage() {
+    std::vector<intel_dnn_component_t*> ordered(components.size());
+
+    uint32_t direct_id = 0;
+    uint32_t delayed_id = static_cast<uint32_t>(components.size() - delayedOperations);
+
+    for (auto &&c : components) {
+        uint32_t &id = c.isDelayed ? delayed_id : direct_id;
+        ordered[id] = &c.dnnComponent;
+        id++;
+    }
+
+    std::vector<memory::MemUsage> usage;
+    size_t step = 0;
+    for (size_t i = 0; i != ordered.size(); i++) {
+        auto &comp = *ordered[i];
+        // activation and pooling might be fused with preceding component into single GNA layer
+        if (i != 0 && comp.operation != kDnnPiecewiselinearOp && comp.operation != kDnnMaxPoolOp) {
+            step++;
+        }
+        usage.push_back({&comp.ptr_inputs, step, false});
+        usage.push_back({&comp.ptr_outputs, step, true});
+        if (comp.operation == kDnnRecurrentOp) {
+            usage.push_back({&comp.op.recurrent.ptr_feedbacks, step, false});
+        }
+    }
+    return usage;
+}
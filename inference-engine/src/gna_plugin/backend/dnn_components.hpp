@@ -7,8 +7,10 @@
 #include <list>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <ie_common.h>
+#include "memory/gna_mem_requests.hpp"
 
 namespace GNAPluginNS {
 namespace backend {
@@ -46,6 +48,11 @@ struct DnnComponents {
      */
     std::vector<intel_dnn_component_t> getExecutionOrder();
 
+    /**
+     * @brief lists reads and writes of components through their input and output pointers, in execution order
+     */
+    std::vector<memory::MemUsage> getMemoryUsage();
+
 private:
     uint32_t delayedOperations = 0;
 };
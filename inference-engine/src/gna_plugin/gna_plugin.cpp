@@ -23,6 +23,7 @@
 #include <legacy/net_pass.h>
 #include <debug.h>
 #include <gna/gna_config.hpp>
+#include <threading/ie_executor_manager.hpp>
 #include "gna_plugin_config.hpp"
 #include "gna_plugin.hpp"
 #include "optimizer/gna_pass_manager.hpp"
@@ -340,6 +341,15 @@ GNAPlugin::GNAPlugin(const std::map<std::string, std::string>& configMap) {
     SetConfig(configMap);
 }
 
+GNAPlugin::~GNAPlugin() {
+    // software requests which are not synced still use components and memory of the plugin
+    for (auto &request : swRequests) {
+        if (request.valid()) {
+            request.wait();
+        }
+    }
+}
+
 void GNAPlugin::Init() {
     dnn = std::make_shared<backend::AMIntelDNN>(backend::AMIntelDNN());
     inputsDesc = std::make_shared<GNAPluginNS::InputDesc>(GNAPluginNS::InputDesc());
@@ -880,6 +890,11 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 
     void *pParallelExecutionData  = nullptr;
 
+    // intermediate buffers which are not alive at the same time share memory
+    if (gnaFlags->compact_mode) {
+        gnamem->setMemoryUsage(graphCompiler.dnnComponents.getMemoryUsage());
+    }
+
     // reserving more bytes for intermediate data in parallel case - TODO: this works incorrectly in compact mode at lest
     rwSegmentSize = gnamem->getRWBytes();
     if (gnaFlags->gna_lib_async_threads_num > 1) {
@@ -916,15 +931,28 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #endif
     }
 
+    // fp32 software requests run in parallel on CPU, each one on own copy of components
+    if (gnaFlags->sw_fp32 && gnaFlags->gna_lib_async_threads_num > 1) {
+        swComponents.assign(gnaFlags->gna_lib_async_threads_num, dnn->component);
+        swRequests.resize(gnaFlags->gna_lib_async_threads_num);
+        swExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"GNAFloatExecutor", gnaFlags->gna_lib_async_threads_num, 0,
+                                     IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
     // creating same gna RW segment for parallel infer requests
     for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
 #if GNA_LIB_VER == 2
-        gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
-        // this can be improved by just copy all structures, but we are too lazy
-        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
+            // this can be improved by just copy all structures, but we are too lazy
+            dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        }
 #else
         nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
-        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        }
 #endif
         // relocate rw pointers to new offset
         auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
@@ -947,6 +975,42 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
             relocate(outputsDesc[j].ptrs[i], outputsDesc[j].ptrs[0]);
         }
 
+        if (gnaFlags->sw_fp32) {
+            auto relocateRW = [&relocate, this](void *& ptr) {
+                auto offset = reinterpret_cast<uint8_t *>(ptr) - reinterpret_cast<uint8_t *>(gnamem->getBasePtr());
+                if (ptr != nullptr && offset >= 0 && static_cast<size_t>(offset) < rwSegmentSize) {
+                    relocate(ptr, ptr);
+                }
+            };
+            for (auto &&component : swComponents[i]) {
+                relocateRW(component.ptr_inputs);
+                relocateRW(component.ptr_outputs);
+                switch (component.operation) {
+                    case kDnnAffineOp:
+                    case kDnnDiagonalOp:
+                        relocateRW(component.op.affine.ptr_weights);
+                        relocateRW(component.op.affine.ptr_biases);
+                        break;
+                    case kDnnConvolutional1dOp:
+                        relocateRW(component.op.conv1D.ptr_filters);
+                        relocateRW(component.op.conv1D.ptr_biases);
+                        break;
+                    case kDnnConvolutional2dOp:
+                        relocateRW(component.op.conv2D.ptr_filters);
+                        relocateRW(component.op.conv2D.ptr_biases);
+                        break;
+                    case kDnnRecurrentOp:
+                        relocateRW(component.op.recurrent.ptr_feedbacks);
+                        relocateRW(component.op.recurrent.ptr_weights);
+                        relocateRW(component.op.recurrent.ptr_biases);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            continue;
+        }
+
 #if GNA_LIB_VER == 2
         for (int j = 0; j != std::get<0>(gnaModels.front())->obj.NumberOfOperations; j++) {
             auto & gnaOperation = std::get<0>(gnaModels[i])->obj.Operations[j];
@@ -1027,7 +1091,11 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 #if GNA_LIB_VER == 2
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice || trivialTopology) {
-        gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        // software requests are slots for components of parallel requests, if any
+        const auto requestsNum = std::max<size_t>(1, swComponents.size());
+        for (size_t i = 0; i != requestsNum; i++) {
+            gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        }
         return;
     }
     for (auto& model : gnaModels) {
@@ -1200,8 +1268,18 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
     // If there is no gnadevice infer using reference FP32 transforamtions
     if (!gnadevice || trivialTopology) {
-        auto runtime = runtime::FP(dnn);
-        runtime.infer();
+        if (swExecutor) {
+            auto task = std::make_shared<std::packaged_task<void()>>([this, idx] {
+                runtime::FP(dnn).infer(swComponents[idx]);
+            });
+            swRequests[idx] = task->get_future();
+            swExecutor->run([task] {
+                (*task)();
+            });
+        } else {
+            auto runtime = runtime::FP(dnn);
+            runtime.infer();
+        }
         if (freeNnet != nnets.end()) {
             std::get<1>(*freeNnet) = 1;
         }
@@ -1244,6 +1322,19 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
     // already synced TODO: might be copy required ???
     if (std::get<1>(nnets[request_idx]) == -1) return GNA_REQUEST_COMPLETED;
 
+    if (request_idx < swRequests.size() && swRequests[request_idx].valid()) {
+        auto &swRequest = swRequests[request_idx];
+        if (swRequest.wait_for(std::chrono::milliseconds(millisTimeout)) != std::future_status::ready) {
+            return GNA_REQUEST_PENDING;
+        }
+        try {
+            swRequest.get();
+        } catch (...) {
+            std::get<1>(nnets[request_idx]) = -1;
+            throw;
+        }
+    }
+
     if (gnadevice && !trivialTopology) {
         const auto waitStatus = gnadevice->wait(std::get<1>(nnets[request_idx]), millisTimeout);
         if (waitStatus == GNA_REQUEST_ABORTED) {
@@ -12,7 +12,9 @@
 #include <memory>
 #include <vector>
 #include <tuple>
+#include <future>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
 #include "cpp_interfaces/impl/ie_variable_state_internal.hpp"
 #include "descriptions/gna_flags.hpp"
 #include "descriptions/gna_input_desc.hpp"
@@ -82,6 +84,14 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      */
     uint32_t rwSegmentSize = 0;
 
+    /**
+     * @brief GNA_SW_FP32 parallel requests: components relocated to RW segment of each request,
+     * and results of requests running on the executor
+     */
+    std::vector<std::vector<intel_dnn_component_t>> swComponents;
+    std::vector<std::future<void>> swRequests;
+    InferenceEngine::ITaskExecutor::Ptr swExecutor;
+
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
     std::vector<InferenceEngine::VariableStateInternal::Ptr> memoryStates;
@@ -93,6 +103,7 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      * @brief construct from aot rather then from cnn network
      */
     GNAPlugin();
+    ~GNAPlugin() override;
 
     std::string GetName() const noexcept override;
     void SetName(const std::string & pluginName) noexcept override;
@@ -102,5 +102,16 @@ struct MemRequest {
                                         _initializer(initializer) {
     }
 };
+
+/**
+ * @brief access of a network component to the memory through a pointer set up by the requests
+ */
+struct MemUsage {
+    // address of the pointer which is set up by the commit, same as _ptr_out of a request
+    const void *ptr;
+    // execution step of the component, components executed as a single layer share the step
+    size_t order;
+    bool write;
+};
 }  // namespace memory
 }  // namespace GNAPluginNS
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include <list>
 #include <algorithm>
 #include <functional>
+#include <limits>
+#include <unordered_map>
 #include "gna_lib_ver_selector.hpp"
 
 namespace GNAPluginNS {
@@ -32,6 +34,9 @@ class GNAMemory : public GNAMemRequestsQueue {
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap = nullptr;
     size_t _page_alignment = 1;
+    std::vector<MemUsage> _usage;
+    // offsets of RW requests inside of RW section, used only if memory usage is known
+    std::vector<size_t> _rw_offsets;
 
     class GNAMemRequestsReadOnlyQueue : public GNAMemRequestsQueue {
         std::reference_wrapper<GNAMemRequestsQueue> _that;
@@ -62,6 +67,15 @@ class GNAMemory : public GNAMemRequestsQueue {
         return readOnlyFrontEnd;
     }
 
+    /**
+     * @brief enables reuse of RW memory: requests that are never alive at the same execution step share storage
+     * @param usage - reads and writes of the network components through the requested pointers.
+     * Requests with pointers missing in usage are treated as alive during whole execution
+     */
+    void setMemoryUsage(std::vector<MemUsage> usage) {
+        _usage = std::move(usage);
+    }
+
     /**
      * @brief calculates size required for all requests, allocates memory and updates pointers
      */
@@ -96,6 +110,10 @@ class GNAMemory : public GNAMemRequestsQueue {
 
                 auto sz = re._element_size * re._num_elements;
 
+                if (re._region == REGION_RW && !(re._type & REQUEST_BIND) && !_rw_offsets.empty()) {
+                    offset = _rw_offsets[&re - &_future_heap.front()];
+                }
+
                 if (re._ptr_out != nullptr) {
                     auto cptr = heap.get() + offset;
                     size_t cptr_avail_size = _total - offset;
@@ -223,9 +241,105 @@ class GNAMemory : public GNAMemRequestsQueue {
                 _ro_section_size += current;
             }
         }
+        if (!_usage.empty()) {
+            _rw_section_size = packReadWriteSection();
+        }
         _rw_section_size = ALIGN(_rw_section_size, _page_alignment);
         _ro_section_size = ALIGN(_ro_section_size, _page_alignment);
     }
+
+    struct Lifetime {
+        size_t first = 0;
+        size_t last = std::numeric_limits<size_t>::max();
+        bool intersects(const Lifetime & other) const {
+            return !(last < other.first || other.last < first);
+        }
+    };
+
+    /**
+     * @brief execution steps between the first write to a request and the last access to it or any of bound requests
+     */
+    Lifetime lifetimeOf(MemRequest & request, const std::unordered_multimap<const void*, MemUsage> & usages) {
+        const Lifetime whole = Lifetime();
+        // content is set up by commit or pointer is used outside of the network components
+        if (request._type != REQUEST_ALLOCATE || request._ptr_out == nullptr) {
+            return whole;
+        }
+        std::vector<const void*> ptrs = {request._ptr_out};
+        bool initialized = false;
+        iterate_binded(request, [&](MemRequest &, MemRequest & binded) {
+            ptrs.push_back(binded._ptr_out);
+            initialized |= (binded._type & REQUEST_INITIALIZER) != 0;
+        });
+        if (initialized) {
+            return whole;
+        }
+
+        Lifetime lifetime;
+        lifetime.first = whole.last;
+        lifetime.last = 0;
+        bool readFirst = false;
+        for (auto ptr : ptrs) {
+            auto range = usages.equal_range(ptr);
+            if (range.first == range.second) {
+                return whole;
+            }
+            for (auto it = range.first; it != range.second; ++it) {
+                auto & usage = it->second;
+                if (usage.order < lifetime.first) {
+                    lifetime.first = usage.order;
+                    readFirst = !usage.write;
+                } else if (usage.order == lifetime.first) {
+                    readFirst |= !usage.write;
+                }
+                lifetime.last = std::max(lifetime.last, usage.order);
+            }
+        }
+        // state kept between inferences or data produced outside of the network
+        return readFirst ? whole : lifetime;
+    }
+
+    /**
+     * @brief first-fit placement of RW requests, requests overlap only if their lifetimes do not intersect
+     * @return size of RW section
+     */
+    size_t packReadWriteSection() {
+        std::unordered_multimap<const void*, MemUsage> usages;
+        for (auto & usage : _usage) {
+            usages.emplace(usage.ptr, usage);
+        }
+
+        struct Placed {
+            size_t begin;
+            size_t end;
+            Lifetime lifetime;
+        };
+        std::vector<Placed> placed;
+        size_t section_size = 0;
+        _rw_offsets.assign(_future_heap.size(), 0);
+
+        for (size_t i = 0; i < _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
+            if ((re._type & REQUEST_BIND) || re._region != REGION_RW) continue;
+
+            auto size = ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
+            auto lifetime = lifetimeOf(re, usages);
+            size_t offset = 0;
+            for (bool moved = true; moved;) {
+                moved = false;
+                for (auto &other : placed) {
+                    if (other.lifetime.intersects(lifetime) && offset < other.end && other.begin < offset + size) {
+                        offset = ALIGN(other.end, re._alignment);
+                        moved = true;
+                    }
+                }
+            }
+            _rw_offsets[i] = offset;
+            placed.push_back({offset, offset + size, lifetime});
+            section_size = std::max(section_size, offset + size);
+        }
+        return section_size;
+    }
 };
 }  // namespace memory
 }  // namespace GNAPluginNS
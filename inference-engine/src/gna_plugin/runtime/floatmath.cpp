@@ -1,13 +1,100 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software FP32 runtime
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "ie_parallel.hpp"
+
+namespace {
+
+constexpr int kRowBlock = 4;       // rows of A sharing one load of B
+constexpr int kDepthBlock = 512;   // part of a row of A kept in L1 while it is reused for every column of B
+constexpr int kLanes = 8;          // independent accumulators, the loops below are written to be auto-vectorized
+constexpr int kRowsPerTask = 16;   // rows of C computed by one parallel task
+constexpr size_t kMinParallelWork = 1 << 16;  // multiply-adds below which threading costs more than it saves
+
+// out[r] = a[r][0..len) . b[0..len) for kRowBlock rows at once
+inline void dotRowBlock(const float* const a[kRowBlock], const float* b, int len, float out[kRowBlock]) {
+    float acc[kRowBlock][kLanes] = {};
+    int p = 0;
+    for (; p + kLanes <= len; p += kLanes) {
+        for (int r = 0; r < kRowBlock; r++) {
+            for (int l = 0; l < kLanes; l++) {
+                acc[r][l] += a[r][p + l] * b[p + l];
+            }
+        }
+    }
+    for (int r = 0; r < kRowBlock; r++) {
+        float sum = 0.0f;
+        for (int l = 0; l < kLanes; l++) {
+            sum += acc[r][l];
+        }
+        for (int q = p; q < len; q++) {
+            sum += a[r][q] * b[q];
+        }
+        out[r] = sum;
+    }
+}
+
+// C[l * ldc + j] (+)= sum_p A[row(l) * lda + p] * B[p * ldb + j] for l in [0, L), j in [0, N)
+// B is packed transposed once, so every dot product streams both operands contiguously
+template <typename RowOfA>
+void sgemmRows(const int L, const int N, const int K, const float *A, const int lda,
+               const float *B, const int ldb, const bool accumulate, float *C, const int ldc,
+               const RowOfA& rowOfA) {
+    std::vector<float> Bt(static_cast<size_t>(N) * K);
+    for (int p = 0; p < K; p++) {
+        for (int j = 0; j < N; j++) {
+            Bt[static_cast<size_t>(j) * K + p] = B[p * ldb + j];
+        }
+    }
+
+    auto computeRows = [&](const int first, const int last) {
+        for (int l0 = first; l0 < last; l0 += kRowBlock) {
+            const int rows = std::min(kRowBlock, last - l0);
+            const float* a[kRowBlock];
+            for (int r = 0; r < kRowBlock; r++) {
+                // the tail block repeats its first row, results of the repeated rows are dropped
+                a[r] = A + rowOfA(l0 + (r < rows ? r : 0)) * lda;
+            }
+            for (int r = 0; r < rows; r++) {
+                if (!accumulate) {
+                    for (int j = 0; j < N; j++) C[(l0 + r) * ldc + j] = 0.0f;
+                }
+            }
+            for (int p0 = 0; p0 < K; p0 += kDepthBlock) {
+                const int depth = std::min(kDepthBlock, K - p0);
+                const float* ablk[kRowBlock];
+                for (int r = 0; r < kRowBlock; r++) ablk[r] = a[r] + p0;
+                for (int j = 0; j < N; j++) {
+                    float sums[kRowBlock];
+                    dotRowBlock(ablk, Bt.data() + static_cast<size_t>(j) * K + p0, depth, sums);
+                    for (int r = 0; r < rows; r++) {
+                        C[(l0 + r) * ldc + j] += sums[r];
+                    }
+                }
+            }
+        }
+    };
+
+    const int tasks = (L + kRowsPerTask - 1) / kRowsPerTask;
+    if (tasks > 1 && static_cast<size_t>(L) * N * K >= kMinParallelWork) {
+        InferenceEngine::parallel_for(tasks, [&](int t) {
+            computeRows(t * kRowsPerTask, std::min(L, (t + 1) * kRowsPerTask));
+        });
+    } else {
+        computeRows(0, L);
+    }
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +114,7 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        sgemmRows(M, N, K, A, lda, B, ldb, beta == 1.0, C, ldc, [](int l) { return l; });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +184,7 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        sgemmRows(L, N, K, A, lda, B, ldb, beta == 1.0, C, ldc, [OutputList](int l) { return OutputList[l]; });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -153,19 +223,35 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
+    const int num_columns = K1 + K2;
+    const int num_rows = N;
+
+    auto computeRows = [&](const int first, const int last) {
+        for (int i0 = first; i0 < last; i0 += kRowBlock) {
+            const int rows = std::min(kRowBlock, last - i0);
+            const float* x[kRowBlock];
+            const float* x2[kRowBlock];
+            for (int r = 0; r < kRowBlock; r++) {
+                x[r] = X + (i0 + (r < rows ? r : 0)) * num_columns;
+                x2[r] = x[r] + K1;
+            }
+            float sums1[kRowBlock];
+            float sums2[kRowBlock];
+            dotRowBlock(x, A1, K1, sums1);
+            dotRowBlock(x2, A2, K2, sums2);
+            for (int r = 0; r < rows; r++) {
+                C[i0 + r] = B[i0 + r] + sums1[r] + sums2[r];
+            }
         }
-        C[i] = sum;
+    };
+
+    const int tasks = (num_rows + kRowsPerTask - 1) / kRowsPerTask;
+    if (tasks > 1 && static_cast<size_t>(num_rows) * num_columns >= kMinParallelWork) {
+        InferenceEngine::parallel_for(tasks, [&](int t) {
+            computeRows(t * kRowsPerTask, std::min(num_rows, (t + 1) * kRowsPerTask));
+        });
+    } else {
+        computeRows(0, num_rows);
     }
 }
 
@@ -18,6 +18,11 @@ class FP {
     }
     virtual void infer();
 
+    /**
+     * @brief runs given components instead of the ones of dnn, e.g. a copy relocated to RW memory of a parallel request
+     */
+    void infer(std::vector<intel_dnn_component_t> &components);
+
     /**
      * atomic operations for floating inference
      */
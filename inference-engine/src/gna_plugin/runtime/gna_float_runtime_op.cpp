@@ -6,6 +6,7 @@
 #include "pwl.h"
 #include "cnn.h"
 #include "floatmath.h"
+#include "ie_parallel.hpp"
 
 using namespace GNAPluginNS;
 using namespace GNAPluginNS::runtime;
@@ -79,10 +80,24 @@ void FP::ApplyDiagonalTransform(intel_dnn_component_t *component) {
             C[i * ldc + j] = bias[i];
         }
     }
-    for (uint32_t j = 0; j < n; j++) {
-        float *Bcol = B + j * component->num_rows_in;
-        float *Ccol = C + j * component->num_rows_out;
-        cblas_ssbmv1(CblasRowMajor, CblasLower, m, 0, 1.0, A, 1, Bcol, 1, 1.0, Ccol, 1);
+    // every column is an independent multiply-add of contiguous vectors (cblas_ssbmv with a diagonal matrix),
+    // so the loop is vectorized and wide layers are split between threads by columns
+    auto applyColumns = [&](uint32_t first, uint32_t last) {
+        for (uint32_t j = first; j < last; j++) {
+            const float *Bcol = B + j * component->num_rows_in;
+            float *Ccol = C + j * component->num_rows_out;
+            for (uint32_t i = 0; i < m; i++) {
+                Ccol[i] += A[i] * Bcol[i];
+            }
+        }
+    };
+    constexpr uint32_t kMinParallelSize = 1 << 16;
+    if (n > 1 && static_cast<size_t>(m) * n >= kMinParallelSize) {
+        InferenceEngine::parallel_for(n, [&](uint32_t j) {
+            applyColumns(j, j + 1);
+        });
+    } else {
+        applyColumns(0, n);
     }
 }
 
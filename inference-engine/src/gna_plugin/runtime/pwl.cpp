@@ -9,6 +9,9 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
 #include "backend/gna_types.h"
 
 #ifdef _NO_MKL_
@@ -30,6 +33,7 @@
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
+#include "ie_parallel.hpp"
 
 double first_deriv_tanh(const double x) { return(1.0 - tanh(x) * tanh(x)); }
 double first_deriv_exp(const double x) { return(exp(x)); }
@@ -64,10 +68,17 @@ double pivot_search(std::vector<pwl_t>& result,
                     const double alpha_N,
                     const double threshold,
                     const bool negative) {
-    std::vector<std::vector<double>> t(N + 1);
-    std::vector<std::vector<double>> alpha(N + 1);
-    std::vector<std::vector<double>> epsilon(N + 1);
-    std::vector<std::vector<double>> d(N + 1);
+    // current iteration: pivots, segment bounds, errors at the bounds and function values at the pivots
+    std::vector<double> t(N);
+    std::vector<double> alpha(N + 1);
+    std::vector<double> epsilon(N + 1);
+    std::vector<double> f_t(N);
+    std::vector<double> first_deriv_f_t(N);
+    // last accepted iteration, the search steps back to it when the error grows
+    std::vector<double> t_prev;
+    std::vector<double> alpha_prev;
+    std::vector<double> epsilon_prev;
+    std::vector<double> d(N);
     bool same_epsilon = false;
     double Delta;
     double epsilon_final = 0.0;
@@ -85,36 +96,37 @@ double pivot_search(std::vector<pwl_t>& result,
     Delta = 1.0;
 
     for (int i = 0; i < N; i++) {
-        t[i].push_back(alpha_0 + (static_cast<double>((i + 1)) / static_cast<double>((N + 1))) * (alpha_N - alpha_0));
+        t[i] = alpha_0 + (static_cast<double>((i + 1)) / static_cast<double>((N + 1))) * (alpha_N - alpha_0);
     }
 
     while (true) {
+        // function is evaluated once per pivot, so the loops below are plain arithmetic over arrays
+        for (int i = 0; i < N; i++) {
+            f_t[i] = f(t[i]);
+            first_deriv_f_t[i] = first_deriv_f(t[i]);
+        }
+
         // Figure 4:  Box #2
-        alpha[0].resize(j + 1);
-        alpha[0][j] = alpha_0;
+        alpha[0] = alpha_0;
         for (int i = 1; i < N; i++) {
-            alpha[i].resize(j + 1);
-            alpha[i][j] = (f(t[i - 1][j]) - f(t[i][j]) + first_deriv_f(t[i][j]) * t[i][j] - first_deriv_f(t[i - 1][j]) * t[i - 1][j])
-                / (first_deriv_f(t[i][j]) - first_deriv_f(t[i - 1][j]));
+            alpha[i] = (f_t[i - 1] - f_t[i] + first_deriv_f_t[i] * t[i] - first_deriv_f_t[i - 1] * t[i - 1])
+                / (first_deriv_f_t[i] - first_deriv_f_t[i - 1]);
         }
-        alpha[N].resize(j + 1);
-        alpha[N][j] = alpha_N;
+        alpha[N] = alpha_N;
 
         // Figure 4:  Box #3
         for (int i = 0; i < N; i++) {
-            epsilon[i].resize(j + 1);
-            epsilon[i][j] = sgn * (first_deriv_f(t[i][j]) * (alpha[i][j] - t[i][j]) + f(t[i][j]) - f(alpha[i][j]));
+            epsilon[i] = sgn * (first_deriv_f_t[i] * (alpha[i] - t[i]) + f_t[i] - f(alpha[i]));
         }
-        epsilon[N].resize(j + 1);
-        epsilon[N][j] = sgn * (first_deriv_f(t[N - 1][j]) * (alpha[N][j] - t[N - 1][j]) + f(t[N - 1][j]) - f(alpha[N][j]));
+        epsilon[N] = sgn * (first_deriv_f_t[N - 1] * (alpha[N] - t[N - 1]) + f_t[N - 1] - f(alpha[N]));
 
         // Figure 4:  Test for completion
         max_epsilon_prev = max_epsilon;
-        max_epsilon = fabs(epsilon[0][j]);
-        min_epsilon = fabs(epsilon[0][j]);
+        max_epsilon = fabs(epsilon[0]);
+        min_epsilon = fabs(epsilon[0]);
         for (int i = 1; i < N + 1; i++) {
-            if (fabs(epsilon[i][j]) > max_epsilon) max_epsilon = fabs(epsilon[i][j]);
-            if (fabs(epsilon[i][j]) < min_epsilon) min_epsilon = fabs(epsilon[i][j]);
+            if (fabs(epsilon[i]) > max_epsilon) max_epsilon = fabs(epsilon[i]);
+            if (fabs(epsilon[i]) < min_epsilon) min_epsilon = fabs(epsilon[i]);
         }
         if ((j == PWL_MAX_ITERATIONS) || (max_epsilon - min_epsilon < threshold * min_epsilon)) {
             pwl_t value;
@@ -122,18 +134,18 @@ double pivot_search(std::vector<pwl_t>& result,
             epsilon_final = (max_epsilon + min_epsilon) / 4.0;  // Andrzej's modification
             for (int i = 0; i < N; i++) {
                 double val, val_next;
-                value.t = t[i][j];
-                value.alpha = alpha[i][j];
-                val = sgn * first_deriv_f(value.t) * (value.alpha - value.t) + sgn * f(value.t) - epsilon_final;
-                val_next = sgn * first_deriv_f(value.t) * (alpha[i + 1][j] - value.t) + sgn * f(value.t) - epsilon_final;
+                value.t = t[i];
+                value.alpha = alpha[i];
+                val = sgn * first_deriv_f_t[i] * (value.alpha - value.t) + sgn * f_t[i] - epsilon_final;
+                val_next = sgn * first_deriv_f_t[i] * (alpha[i + 1] - value.t) + sgn * f_t[i] - epsilon_final;
                 value.beta = val;
-                value.m = (val_next - val) / (alpha[i + 1][j] - value.alpha);
+                value.m = (val_next - val) / (alpha[i + 1] - value.alpha);
                 value.b = (val - value.m * value.alpha);
                 result.push_back(value);
             }
             value.t = value.m = value.b = 0.0;
-            value.alpha = alpha[N][j];
-            value.beta = sgn * first_deriv_f(t[N - 1][j]) * (alpha[N][j] - t[N - 1][j]) + sgn * f(t[N - 1][j]) - epsilon_final;
+            value.alpha = alpha[N];
+            value.beta = sgn * first_deriv_f_t[N - 1] * (alpha[N] - t[N - 1]) + sgn * f_t[N - 1] - epsilon_final;
             result.push_back(value);
             if (j == PWL_MAX_ITERATIONS) {
                 THROW_GNA_EXCEPTION << "Failed to converge in pivot_search!";
@@ -141,34 +153,38 @@ double pivot_search(std::vector<pwl_t>& result,
             return(epsilon_final);
         }
 
+        bool step_back = false;
         if (j > 0) {
             if (max_epsilon > max_epsilon_prev) {
-                j = j - 1;
-                Delta = Delta / 2;
+                step_back = true;
             } else if (max_epsilon == max_epsilon_prev) {
                 if (!same_epsilon) {
                     same_epsilon = true;
                 } else {
-                    j = j - 1;
-                    Delta = Delta / 2;
+                    step_back = true;
                     same_epsilon = false;
                 }
             }
         }
+        if (step_back) {
+            j = j - 1;
+            Delta = Delta / 2;
+        } else {
+            t_prev = t;
+            alpha_prev = alpha;
+            epsilon_prev = epsilon;
+        }
 
         // Figure 4:  Box #4
         for (int i = 0; i < N; i++) {
-            d[i].resize(j + 1);
-            d[i][j] = Delta * (epsilon[i + 1][j] - epsilon[i][j]) /
-                ((epsilon[i + 1][j] / (alpha[i + 1][j] - t[i][j])) + (epsilon[i][j] / (t[i][j] - alpha[i][j])));
+            d[i] = Delta * (epsilon_prev[i + 1] - epsilon_prev[i]) /
+                ((epsilon_prev[i + 1] / (alpha_prev[i + 1] - t_prev[i])) + (epsilon_prev[i] / (t_prev[i] - alpha_prev[i])));
         }
 
         // Figure 4:  Box #5
         for (int i = 0; i < N; i++) {
-            t[i].resize(j + 2);
-            t[i][j + 1] = t[i][j] + d[i][j];
+            t[i] = t_prev[i] + d[i];
         }
-        t[N].resize(j + 2);
 
         j = j + 1;
     }
@@ -324,13 +340,13 @@ inline std::vector<pwl_t> negative_pwl(const std::vector<pwl_t>& pwl) {
     return(new_pwl);
 }
 
-std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
-                                const double l_bound,
-                                const double u_bound,
-                                const double threshold,
-                                const double allowed_err_pct,
-                                const int samples,
-                                double& err_pct) {
+static std::vector<pwl_t> pwl_search_uncached(const DnnActivation& activation_type,
+                                              const double l_bound,
+                                              const double u_bound,
+                                              const double threshold,
+                                              const double allowed_err_pct,
+                                              const int samples,
+                                              double& err_pct) {
     std::vector<pwl_t> pwl;
     double err = 0.0;
     int n_segments = 1;
@@ -495,6 +511,52 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
     return(pwl);
 }
 
+namespace {
+// activation with its arguments, input range, threshold, allowed error and number of samples
+using PwlSearchKey = std::tuple<DnnActivationType, float, float, float, double, double, double, double, int>;
+struct PwlSearchResult {
+    std::vector<pwl_t> pwl;
+    double err_pct;
+};
+// bounds memory in case of many networks with different input statistics loaded by the process
+constexpr size_t PWL_SEARCH_CACHE_MAX_SIZE = 1024;
+std::mutex pwl_search_cache_mutex;
+std::map<PwlSearchKey, PwlSearchResult> pwl_search_cache;
+}  // namespace
+
+std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
+                              const double l_bound,
+                              const double u_bound,
+                              const double threshold,
+                              const double allowed_err_pct,
+                              const int samples,
+                              double& err_pct) {
+    // the design depends only on the key, so layers with the same activation and scale factors,
+    // e.g. gates of LSTM cells, reuse the segments found for the first one
+    const bool is_pow = activation_type == kActPow;
+    const PwlSearchKey key{activation_type.type,
+                           is_pow ? activation_type.args.pow.exponent : 0.0f,
+                           is_pow ? activation_type.args.pow.scale : 0.0f,
+                           is_pow ? activation_type.args.pow.offset : 0.0f,
+                           l_bound, u_bound, threshold, allowed_err_pct, samples};
+    {
+        std::lock_guard<std::mutex> lock(pwl_search_cache_mutex);
+        auto cached = pwl_search_cache.find(key);
+        if (cached != pwl_search_cache.end()) {
+            err_pct = cached->second.err_pct;
+            return cached->second.pwl;
+        }
+    }
+
+    auto pwl = pwl_search_uncached(activation_type, l_bound, u_bound, threshold, allowed_err_pct, samples, err_pct);
+
+    std::lock_guard<std::mutex> lock(pwl_search_cache_mutex);
+    if (pwl_search_cache.size() >= PWL_SEARCH_CACHE_MAX_SIZE) {
+        pwl_search_cache.clear();
+    }
+    pwl_search_cache[key] = PwlSearchResult{pwl, err_pct};
+    return pwl;
+}
 
 void PwlDesignOpt16(const DnnActivation activation_type,
                     std::vector<gna_pwl_segment_t> &ptr_segment,
@@ -951,6 +1013,68 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+namespace {
+
+constexpr uint32_t kPwlChunk = 4096;                // elements evaluated by one parallel task
+constexpr uint32_t kPwlMinParallelSize = 4 * kPwlChunk;
+
+// Evaluates f over the window of the matrix. Window rows spanning all the columns are contiguous,
+// so they are processed as one flat range: the loop is free of index math and can be vectorized
+// by the compiler for the arithmetic activations, large ranges are split between threads
+template <typename F>
+void PwlApplyElementwise32(const float *ptr_in, float *ptr_out, uint32_t num_columns,
+                           uint32_t num_row_start, uint32_t num_row_end,
+                           uint32_t num_col_start, uint32_t num_col_end, const F &f) {
+    auto apply = [&f](const float *in, float *out, uint32_t size) {
+        for (uint32_t i = 0; i < size; i++) {
+            out[i] = static_cast<float>(f(in[i]));
+        }
+    };
+
+    const uint32_t width = num_col_end - num_col_start + 1;
+    if (width != num_columns) {
+        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            apply(ptr_in + i * num_columns + num_col_start, ptr_out + i * num_columns + num_col_start, width);
+        }
+        return;
+    }
+
+    const float *in = ptr_in + num_row_start * num_columns;
+    float *out = ptr_out + num_row_start * num_columns;
+    const uint32_t size = (num_row_end - num_row_start + 1) * num_columns;
+    if (size < kPwlMinParallelSize) {
+        apply(in, out, size);
+        return;
+    }
+    InferenceEngine::parallel_for((size + kPwlChunk - 1) / kPwlChunk, [&](uint32_t chunk) {
+        const uint32_t offset = chunk * kPwlChunk;
+        apply(in + offset, out + offset, std::min(kPwlChunk, size - offset));
+    });
+}
+
+// Rational minimax approximation of tanh in single precision, within 4e-7 of the exact value.
+// Unlike the libm call it has no branches, so the loops of sigmoid and tanh are vectorized as well
+inline float TanhApprox32(float x) {
+    const float clamped = std::min(std::max(x, -7.90531110763549805f), 7.90531110763549805f);
+    const float x2 = clamped * clamped;
+    float p = -2.76076847742355e-16f;
+    p = p * x2 + 2.00018790482477e-13f;
+    p = p * x2 - 8.60467152213735e-11f;
+    p = p * x2 + 5.12229709037114e-08f;
+    p = p * x2 + 1.48572235717979e-05f;
+    p = p * x2 + 6.37261928875436e-04f;
+    p = p * x2 + 4.89352455891786e-03f;
+    float q = 1.19825839466702e-06f;
+    q = q * x2 + 1.18534705686654e-04f;
+    q = q * x2 + 2.26843463243900e-03f;
+    q = q * x2 + 4.89352518554385e-03f;
+    const float result = clamped * p / q;
+    // tanh(x) rounds to x near zero, where the ratio of the polynomials loses relative precision
+    return std::fabs(x) < 0.0004f ? x : result;
+}
+
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
@@ -962,111 +1086,66 @@ void PwlApply32(intel_dnn_component_t *component,
     uint32_t num_columns = component->num_columns_in;
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return 0.5f * (1.0f + TanhApprox32(0.5f * x)); });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return TanhApprox32(x); });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return x / (1.0 + fabs(x)); });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
-            }
+        case kActRelu: {
+            const float negative_slope = transform->func_id.args.lrelu.negative_slope;
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [negative_slope](float x) { return (x < 0.0f) ? x * negative_slope : x; });
             break;
+        }
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return x; });
             break;
         case kActKaldiLstmClipping: {
             float upper_limit = component->op.pwl.func_id.args.clamp.high;
             float lower_limit = component->op.pwl.func_id.args.clamp.low;
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > upper_limit) {
-                        ptr_out[i * num_columns + j] = upper_limit;
-                    } else if (val < lower_limit) {
-                        ptr_out[i * num_columns + j] = lower_limit;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [upper_limit, lower_limit](float x) {
+                    return (x > upper_limit) ? upper_limit : ((x < lower_limit) ? lower_limit : x);
+                });
             break;
         }
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return exp(x); });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return log(x); });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return fabs(x); });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return (x == 0) ? 0.0f : ((x > 0) ? 1.0f : -1.0f); });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return -1.0 * log(x); });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                [](float x) { return -0.5 * log(x); });
             break;
         case kActPow: {
                 float exponent = transform->func_id.args.pow.exponent;
                 float scale = transform->func_id.args.pow.scale;
                 float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
-                    }
-                }
+                PwlApplyElementwise32(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                    [exponent, scale, offset](float x) { return pow(offset + scale * x, exponent); });
             }
             break;
         case kActFakeQuantize: {
@@ -270,6 +270,34 @@ TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
     return TensorDesc{subBlobDesc.getPrecision(), blobDims, blobLayout};
 }
 
+TensorDesc verifyBatchedROIBlobInput(const Blob::Ptr& image, const std::vector<ROI>& rois) {
+    if (image == nullptr) {
+        THROW_IE_EXCEPTION << "Cannot create a BatchedROIBlob from nullptr image Blob object";
+    }
+
+    // regions are resized by the pre-processing, which supports these image blobs only
+    if (!image->is<MemoryBlob>() && !image->is<NV12Blob>() && !image->is<I420Blob>()) {
+        THROW_IE_EXCEPTION << "BatchedROIBlob image must be a MemoryBlob, NV12Blob or I420Blob object";
+    }
+
+    if (rois.empty()) {
+        THROW_IE_EXCEPTION << "BatchedROIBlob cannot be created from empty vector of ROI, Please, make sure vector contains at least one ROI";
+    }
+
+    const auto imageDesc = getBlobTensorDesc(image);
+    if (imageDesc.getLayout() != NCHW && imageDesc.getLayout() != NHWC) {
+        THROW_IE_EXCEPTION << "Unsupported image layout - to be one of: [NCHW, NHWC]";
+    }
+
+    SizeVector blobDims = imageDesc.getDims();
+    if (blobDims[0] != 1) {
+        THROW_IE_EXCEPTION << "BatchedROIBlob image should be batch 1";
+    }
+    blobDims[0] = rois.size();
+
+    return TensorDesc{imageDesc.getPrecision(), blobDims, imageDesc.getLayout()};
+}
+
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(const TensorDesc& tensorDesc): Blob(tensorDesc) {}
@@ -472,4 +500,13 @@ BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs)
     this->_blobs = std::move(blobs);
 }
 
+BatchedROIBlob::BatchedROIBlob(const Blob::Ptr& image, const std::vector<ROI>& rois)
+    : CompoundBlob(verifyBatchedROIBlobInput(image, rois)) {
+    // ROI blobs share the image memory, their bounds are checked on creation
+    this->_blobs.reserve(rois.size());
+    for (const auto& roi : rois) {
+        this->_blobs.push_back(image->createROI(roi));
+    }
+}
+
 }  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
 #include "details/ie_exception.hpp"
+#include "threading/ie_cpu_topology.hpp"
 #include <numeric>
 
 
@@ -56,12 +57,20 @@ struct CPU {
 static CPU cpu;
 #if !((IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
+    const auto& topology = GetCpuTopology();
+    if (!topology.empty()) {
+        return topology.GetNumaNodes();
+    }
     std::vector<int> nodes((0 == cpu._sockets) ? 1 : cpu._sockets);
     std::iota(std::begin(nodes), std::end(nodes), 0);
     return nodes;
 }
 #endif
 int getNumberOfCPUCores() {
+    const auto& topology = GetCpuTopology();
+    if (!topology.empty()) {
+        return topology.GetCoresNumber();
+    }
     unsigned numberOfProcessors = cpu._processors;
     unsigned totalNumberOfCpuCores = cpu._cores;
     IE_ASSERT(totalNumberOfCpuCores != 0);
@@ -13,6 +13,8 @@
 #include <climits>
 #include <cassert>
 #include <utility>
+#include <algorithm>
+#include <chrono>
 
 #include "threading/ie_thread_local.hpp"
 #include "ie_parallel.hpp"
@@ -146,6 +148,23 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    struct QueuedTask {
+        Task                                    _task;
+        Priority                                _priority;
+        std::chrono::steady_clock::time_point   _deadline;
+        std::uint64_t                           _sequence;
+        // The heap top is the task with the highest priority, then the earliest deadline, then the earliest submission
+        bool operator<(const QueuedTask& other) const {
+            if (_priority != other._priority) {
+                return _priority < other._priority;
+            }
+            if (_deadline != other._deadline) {
+                return _deadline > other._deadline;
+            }
+            return _sequence > other._sequence;
+        }
+    };
+
     explicit Impl(const Config& config) :
         _config{config},
         _streams([this] {
@@ -168,8 +187,9 @@ struct CPUStreamsExecutor::Impl {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
                         if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                            std::pop_heap(_taskQueue.begin(), _taskQueue.end());
+                            task = std::move(_taskQueue.back()._task);
+                            _taskQueue.pop_back();
                         }
                     }
                     if (task) {
@@ -180,10 +200,11 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, Priority priority, std::chrono::steady_clock::time_point deadline) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueue.push_back(QueuedTask{std::move(task), priority, deadline, _taskSequence++});
+            std::push_heap(_taskQueue.begin(), _taskQueue.end());
         }
         _queueCondVar.notify_one();
     }
@@ -223,7 +244,8 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::vector<QueuedTask>                 _taskQueue;
+    std::uint64_t                           _taskSequence = 0;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -262,10 +284,14 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run(std::move(task), Priority::MEDIUM, std::chrono::steady_clock::time_point::max());
+}
+
+void CPUStreamsExecutor::run(Task task, Priority priority, std::chrono::steady_clock::time_point deadline) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority, deadline);
     }
 }
 
@@ -0,0 +1,248 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_cpu_topology.hpp"
+#include "threading/ie_thread_affinity.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace InferenceEngine {
+namespace {
+bool ReadFirstLine(const std::string& path, std::string& line) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::getline(file, line);
+    return true;
+}
+
+// Parses the sysfs cpu list format, e.g. "0-3,8,10-11"
+bool ReadCpuList(const std::string& path, std::vector<int>& cpus) {
+    std::string line;
+    if (!ReadFirstLine(path, line)) {
+        return false;
+    }
+    cpus.clear();
+    std::size_t begin = 0;
+    while (begin < line.size()) {
+        auto end = line.find(',', begin);
+        if (end == std::string::npos) {
+            end = line.size();
+        }
+        const auto range = line.substr(begin, end - begin);
+        begin = end + 1;
+        if (range.find_first_of("0123456789") == std::string::npos) {
+            continue;
+        }
+        try {
+            const auto dash = range.find('-');
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int ReadInt(const std::string& path, int fallback) {
+    std::string line;
+    if (!ReadFirstLine(path, line)) {
+        return fallback;
+    }
+    try {
+        return std::stoi(line);
+    } catch (const std::exception&) {
+        return fallback;
+    }
+}
+
+// Numbers SMT siblings of every core in the order of logical CPU ids
+void RankSiblings(std::vector<CpuTopology::Processor>& processors) {
+    std::map<int, int> siblings;
+    for (auto&& processor : processors) {
+        processor._smtRank = siblings[processor._core]++;
+    }
+}
+}  // namespace
+
+bool CpuTopology::empty() const {
+    return _processors.empty();
+}
+
+int CpuTopology::GetCoresNumber() const {
+    std::set<int> cores;
+    for (auto&& processor : _processors) {
+        cores.insert(processor._core);
+    }
+    return static_cast<int>(cores.size());
+}
+
+std::vector<int> CpuTopology::GetNumaNodes() const {
+    std::set<int> nodes;
+    for (auto&& processor : _processors) {
+        nodes.insert(processor._numaNode);
+    }
+    return {nodes.begin(), nodes.end()};
+}
+
+std::vector<std::vector<int>> CpuTopology::GetCacheGroups() const {
+    // groups are ordered by NUMA node and then by the first logical CPU id of the group
+    std::map<std::pair<int, int>, std::vector<int>> groups;
+    std::map<int, int> groupFirstCpu;
+    for (auto&& processor : _processors) {
+        if (0 == processor._smtRank) {
+            auto firstCpu = groupFirstCpu.emplace(processor._l2Group, processor._cpu).first->second;
+            groups[{processor._numaNode, firstCpu}].push_back(processor._cpu);
+        }
+    }
+    std::vector<std::vector<int>> result;
+    for (auto&& group : groups) {
+        result.emplace_back(std::move(group.second));
+    }
+    return result;
+}
+
+std::vector<int> CpuTopology::GetPinningOrder() const {
+    std::map<int, const Processor*> processorByCpu;
+    std::map<std::pair<int, int>, int> cpuByCoreAndRank;
+    int maxRank = 0;
+    for (auto&& processor : _processors) {
+        cpuByCoreAndRank[{processor._core, processor._smtRank}] = processor._cpu;
+        processorByCpu[processor._cpu] = &processor;
+        maxRank = std::max(maxRank, processor._smtRank);
+    }
+    std::vector<int> order;
+    const auto groups = GetCacheGroups();
+    for (int rank = 0; rank <= maxRank; ++rank) {
+        for (auto&& group : groups) {
+            for (auto&& firstThread : group) {
+                auto it = cpuByCoreAndRank.find({processorByCpu[firstThread]->_core, rank});
+                if (it != cpuByCoreAndRank.end()) {
+                    order.push_back(it->second);
+                }
+            }
+        }
+    }
+    return order;
+}
+
+CpuTopology CpuTopology::Restrict(const std::vector<int>& cpus) const {
+    const std::set<int> allowed(cpus.begin(), cpus.end());
+    CpuTopology restricted;
+    for (auto&& processor : _processors) {
+        if (allowed.count(processor._cpu) != 0) {
+            restricted._processors.push_back(processor);
+        }
+    }
+    RankSiblings(restricted._processors);
+    return restricted;
+}
+
+CpuTopology ParseCpuTopology(const std::string& sysfsRoot) {
+    CpuTopology topology;
+    const auto cpuRoot = sysfsRoot + "/devices/system/cpu/";
+    std::vector<int> online;
+    if (!ReadCpuList(cpuRoot + "online", online)) {
+        return topology;
+    }
+
+    std::set<int> excluded;
+    std::vector<int> isolated;
+    if (ReadCpuList(cpuRoot + "isolated", isolated)) {
+        excluded.insert(isolated.begin(), isolated.end());
+    }
+    std::map<int, int> cpuNumaNode;
+    std::vector<int> nodes;
+    if (ReadCpuList(sysfsRoot + "/devices/system/node/online", nodes)) {
+        for (auto&& node : nodes) {
+            std::vector<int> nodeCpus;
+            if (ReadCpuList(sysfsRoot + "/devices/system/node/node" + std::to_string(node) + "/cpulist", nodeCpus)) {
+                for (auto&& cpu : nodeCpus) {
+                    cpuNumaNode[cpu] = node;
+                }
+            }
+        }
+    }
+
+    std::map<std::pair<int, int>, int> cores;
+    std::map<std::string, int> l2Groups;
+    std::map<std::string, int> l3Groups;
+    for (auto&& cpu : online) {
+        if (excluded.count(cpu) != 0) {
+            continue;
+        }
+        const auto cpuPath = cpuRoot + "cpu" + std::to_string(cpu) + "/";
+        CpuTopology::Processor processor;
+        processor._cpu = cpu;
+        processor._socket = std::max(0, ReadInt(cpuPath + "topology/physical_package_id", 0));
+        const int coreId = ReadInt(cpuPath + "topology/core_id", cpu);
+        processor._core = cores.emplace(std::make_pair(processor._socket, coreId), static_cast<int>(cores.size())).first->second;
+        auto numaNode = cpuNumaNode.find(cpu);
+        processor._numaNode = (numaNode != cpuNumaNode.end()) ? numaNode->second : 0;
+
+        // caches without the description are considered private to the core or to the package
+        std::string l2Cpus = "core" + std::to_string(processor._core);
+        std::string l3Cpus = "socket" + std::to_string(processor._socket);
+        for (int index = 0;; ++index) {
+            const auto cachePath = cpuPath + "cache/index" + std::to_string(index) + "/";
+            std::string type, sharedCpus;
+            if (!ReadFirstLine(cachePath + "type", type) || !ReadFirstLine(cachePath + "shared_cpu_list", sharedCpus)) {
+                break;
+            }
+            if (type == "Instruction") {
+                continue;
+            }
+            const int level = ReadInt(cachePath + "level", 0);
+            if (level == 2) {
+                l2Cpus = sharedCpus;
+            } else if (level == 3) {
+                l3Cpus = sharedCpus;
+            }
+        }
+        processor._l2Group = l2Groups.emplace(l2Cpus, static_cast<int>(l2Groups.size())).first->second;
+        processor._l3Group = l3Groups.emplace(l3Cpus, static_cast<int>(l3Groups.size())).first->second;
+        topology._processors.push_back(processor);
+    }
+    RankSiblings(topology._processors);
+    return topology;
+}
+
+const CpuTopology& GetCpuTopology() {
+    static const CpuTopology topology = [] {
+#if !(defined(__APPLE__) || defined(_WIN32))
+        auto parsed = ParseCpuTopology("/sys");
+        CpuSet mask;
+        int ncpus = 0;
+        std::tie(mask, ncpus) = GetProcessMask();
+        if (nullptr != mask) {
+            const size_t size = CPU_ALLOC_SIZE(ncpus);
+            std::vector<int> allowed;
+            for (int cpu = 0; cpu < ncpus; ++cpu) {
+                if (CPU_ISSET_S(cpu, size, mask.get())) {
+                    allowed.push_back(cpu);
+                }
+            }
+            parsed = parsed.Restrict(allowed);
+        }
+        return parsed;
+#else
+        return CpuTopology{};
+#endif
+    }();
+    return topology;
+}
+
+}  // namespace InferenceEngine
@@ -23,10 +23,18 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
 }
 
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return getCPUStreamsExecutor(config, false);
+}
+
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return getCPUStreamsExecutor(config, true);
+}
+
+IStreamsExecutor::Ptr ExecutorManagerImpl::getCPUStreamsExecutor(const IStreamsExecutor::Config& config, bool shared) {
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
         const auto& executor = it.second;
-        if (executor.use_count() != 1)
+        if (!shared && executor.use_count() != 1)
             continue;
 
         const auto& executorConfig = it.first;
@@ -131,4 +139,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
 }  // namespace InferenceEngine
@@ -3,6 +3,7 @@
 //
 
 #include "threading/ie_istreams_executor.hpp"
+#include "threading/ie_cpu_topology.hpp"
 #include "ie_plugin_config.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "details/ie_exception.hpp"
@@ -18,6 +19,10 @@
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::run(Task task, Priority, std::chrono::steady_clock::time_point) {
+    run(std::move(task));
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
@@ -54,10 +59,17 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
             if (value == CONFIG_VALUE(CPU_THROUGHPUT_NUMA)) {
                 _streams = static_cast<int>(getAvailableNUMANodes().size());
             } else if (value == CONFIG_VALUE(CPU_THROUGHPUT_AUTO)) {
+                const auto& topology = GetCpuTopology();
+                const auto cacheGroups = topology.GetCacheGroups().size();
                 const int sockets = static_cast<int>(getAvailableNUMANodes().size());
                 // bare minimum of streams (that evenly divides available number of core)
-                const int num_cores = sockets == 1 ? std::thread::hardware_concurrency() : getNumberOfCPUCores();
-                if (0 == num_cores % 4)
+                // SMT siblings are not counted when the topology is known, as they share the core with the stream
+                const int num_cores = !topology.empty() ? topology.GetCoresNumber()
+                                    : sockets == 1 ? std::thread::hardware_concurrency() : getNumberOfCPUCores();
+                if (cacheGroups > 1 && static_cast<int>(cacheGroups) < num_cores)
+                    // several cores share L2 cache, so a stream per cache group
+                    _streams = static_cast<int>(cacheGroups);
+                else if (0 == num_cores % 4)
                     _streams = std::max(4, num_cores / 4);
                 else if (0 == num_cores % 5)
                     _streams = std::max(5, num_cores / 5);
@@ -141,7 +153,10 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
     const auto& numaNodes = getAvailableNUMANodes();
     const auto numaNodesNum = numaNodes.size();
     auto streamExecutorConfig = initial;
-    const auto hwCores = streamExecutorConfig._streams > 1 && numaNodesNum == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
+    const auto& topology = GetCpuTopology();
+    // with the known topology the streams do not share physical cores via SMT siblings
+    const auto hwCores = !topology.empty() ? topology.GetCoresNumber()
+                       : streamExecutorConfig._streams > 1 && numaNodesNum == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
     const auto threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
     streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
                                             ? std::max(1, threads/streamExecutorConfig._streams)
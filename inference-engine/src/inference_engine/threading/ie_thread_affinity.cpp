@@ -3,11 +3,13 @@
 //
 
 #include "threading/ie_thread_affinity.hpp"
+#include "threading/ie_cpu_topology.hpp"
 #include "ie_system_conf.h"
 #include <climits>
 #include <cerrno>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 
 #if !(defined(__APPLE__) || defined(_WIN32))
@@ -46,6 +48,22 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
     if (procMask == nullptr)
         return false;
     const size_t size = CPU_ALLOC_SIZE(ncores);
+    const auto& topology = GetCpuTopology();
+    if (1 == hyperthreads && !topology.empty()) {
+        // neighbouring threads share caches, SMT siblings are used after all physical cores
+        std::vector<int> order;
+        for (auto&& cpu : topology.GetPinningOrder()) {
+            if (cpu < ncores && CPU_ISSET_S(cpu, size, procMask.get())) {
+                order.push_back(cpu);
+            }
+        }
+        if (!order.empty()) {
+            CpuSet targetMask{CPU_ALLOC(ncores)};
+            CPU_ZERO_S(size, targetMask.get());
+            CPU_SET_S(order[thrIdx % order.size()], size, targetMask.get());
+            return PinCurrentThreadByMask(ncores, targetMask);
+        }
+    }
     const int num_cpus = CPU_COUNT_S(size, procMask.get());
     thrIdx %= num_cpus;  // To limit unique number in [; num_cpus-1] range
     // Place threads with specified step
@@ -83,8 +101,17 @@ bool PinCurrentThreadToSocket(int socket) {
     const size_t size = CPU_ALLOC_SIZE(ncpus);
     CPU_ZERO_S(size, targetMask.get());
 
-    for (int core = socket*cores_per_socket; core < (socket+1)*cores_per_socket; core++) {
-        CPU_SET_S(core, size, targetMask.get());
+    const auto& topology = GetCpuTopology();
+    if (!topology.empty()) {
+        for (auto&& processor : topology._processors) {
+            if (processor._numaNode == socket && processor._cpu < ncpus) {
+                CPU_SET_S(processor._cpu, size, targetMask.get());
+            }
+        }
+    } else {
+        for (int core = socket*cores_per_socket; core < (socket+1)*cores_per_socket; core++) {
+            CPU_SET_S(core, size, targetMask.get());
+        }
     }
     // respect the user-defined mask for the entire process
     CPU_AND_S(size, targetMask.get(), targetMask.get(), mask.get());
@@ -79,6 +79,30 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_MODEL_PRIORITY) {
+            if (val == PluginConfigParams::MODEL_PRIORITY_HIGH)
+                modelPriority = IStreamsExecutor::Priority::HIGH;
+            else if (val == PluginConfigParams::MODEL_PRIORITY_MED)
+                modelPriority = IStreamsExecutor::Priority::MEDIUM;
+            else if (val == PluginConfigParams::MODEL_PRIORITY_LOW)
+                modelPriority = IStreamsExecutor::Priority::LOW;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_MODEL_PRIORITY
+                                   << ". Expected only MODEL_PRIORITY_HIGH/MODEL_PRIORITY_MED/MODEL_PRIORITY_LOW";
+            prioritizedExecution = true;
+        } else if (key == PluginConfigParams::KEY_MODEL_DEADLINE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_MODEL_DEADLINE
+                                   << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_MODEL_DEADLINE
+                                   << ". Expected only non negative integer numbers";
+            modelDeadline = val_i;
+            prioritizedExecution = true;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -89,6 +113,32 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key.compare(PluginConfigInternalParams::KEY_SNIPPETS_MODE) == 0) {
+            if (val == PluginConfigParams::NO)
+                enableSnippets = false;
+            else if (val == PluginConfigParams::YES)
+                enableSnippets = true;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE;
+        } else if (key.compare(PluginConfigInternalParams::KEY_DYNAMIC_QUANTIZATION) == 0) {
+            if (val == PluginConfigParams::NO)
+                dynamicQuantization = DynamicQuantizationMode::Disabled;
+            else if (val == PluginConfigInternalParams::PER_TENSOR)
+                dynamicQuantization = DynamicQuantizationMode::PerTensor;
+            else if (val == PluginConfigInternalParams::PER_ROW)
+                dynamicQuantization = DynamicQuantizationMode::PerRow;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_DYNAMIC_QUANTIZATION;
+        } else if (key.compare(PluginConfigInternalParams::KEY_INTER_OP_PARALLELISM) == 0) {
+            if (val == PluginConfigParams::NO)
+                enableInterOpParallelism = false;
+            else if (val == PluginConfigParams::YES)
+                enableInterOpParallelism = true;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_INTER_OP_PARALLELISM;
+        } else if (key.compare(PluginConfigInternalParams::KEY_DETAILED_PERF_COUNT) == 0) {
+            // empty string means that profiling is switched off
+            dumpDetailedPerf = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -145,6 +195,18 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        switch (modelPriority) {
+            case IStreamsExecutor::Priority::HIGH:
+                _config.insert({ PluginConfigParams::KEY_MODEL_PRIORITY, PluginConfigParams::MODEL_PRIORITY_HIGH });
+            break;
+            case IStreamsExecutor::Priority::MEDIUM:
+                _config.insert({ PluginConfigParams::KEY_MODEL_PRIORITY, PluginConfigParams::MODEL_PRIORITY_MED });
+            break;
+            case IStreamsExecutor::Priority::LOW:
+                _config.insert({ PluginConfigParams::KEY_MODEL_PRIORITY, PluginConfigParams::MODEL_PRIORITY_LOW });
+            break;
+        }
+        _config.insert({ PluginConfigParams::KEY_MODEL_DEADLINE, std::to_string(modelDeadline) });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
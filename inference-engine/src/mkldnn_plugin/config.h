@@ -18,6 +18,12 @@ struct Config {
         On,
     };
 
+    enum DynamicQuantizationMode {
+        Disabled,
+        PerTensor,
+        PerRow,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -26,6 +32,13 @@ struct Config {
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
+    bool prioritizedExecution = false;
+    InferenceEngine::IStreamsExecutor::Priority modelPriority = InferenceEngine::IStreamsExecutor::Priority::MEDIUM;
+    int modelDeadline = 0;
+    bool enableSnippets = false;
+    DynamicQuantizationMode dynamicQuantization = DynamicQuantizationMode::Disabled;
+    bool enableInterOpParallelism = false;
+    std::string dumpDetailedPerf = "";
 
 #if defined(__arm__) || defined(__aarch64__)
     // Currently INT8 mode is not optimized on ARM, fallback to FP32 mode.
@@ -0,0 +1,198 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+
+#include <set>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "snippets/snippets_isa.hpp"
+#include "snippets/pass/vector_to_scalar.hpp"
+
+#include "jit_snippets_emitters.hpp"
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_emitters.hpp"
+
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+// emitters are created by the generator after the target machine is gone, so the lambdas capture the host by value
+#define CREATE_EMITTER(e_type) [host, host_isa](const std::shared_ptr<ngraph::Node>& n) \
+    -> std::shared_ptr<ngraph::snippets::Emitter> { return std::make_shared<e_type>(host, host_isa, n); }
+
+CPUTargetMachine::CPUTargetMachine(jit_generator* h, cpu_isa_t host_isa) : h(h), isa(host_isa) {}
+
+auto CPUTargetMachine::getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                                std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> {
+    std::map<const ngraph::DiscreteTypeInfo, std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> jitters;
+    jit_generator* host = h;
+    cpu_isa_t host_isa = isa;
+
+    // data movement
+    jitters[ngraph::snippets::op::Load::type_info] = CREATE_EMITTER(jit_snippets_load_emitter);
+    jitters[ngraph::snippets::op::ScalarLoad::type_info] = CREATE_EMITTER(jit_snippets_scalar_load_emitter);
+    jitters[ngraph::snippets::op::BroadcastLoad::type_info] = CREATE_EMITTER(jit_snippets_broadcast_load_emitter);
+    jitters[ngraph::snippets::op::Store::type_info] = CREATE_EMITTER(jit_snippets_store_emitter);
+    jitters[ngraph::snippets::op::ScalarStore::type_info] = CREATE_EMITTER(jit_snippets_scalar_store_emitter);
+    jitters[ngraph::snippets::op::BroadcastMove::type_info] = CREATE_EMITTER(jit_snippets_broadcast_move_emitter);
+    jitters[ngraph::snippets::op::Scalar::type_info] = CREATE_EMITTER(jit_snippets_scalar_emitter);
+    jitters[ngraph::snippets::op::Nop::type_info] = CREATE_EMITTER(jit_snippets_nop_emitter);
+
+    // binary
+    jitters[ngraph::opset1::Add::type_info] = CREATE_EMITTER(jit_add_emitter);
+    jitters[ngraph::opset1::Subtract::type_info] = CREATE_EMITTER(jit_subtract_emitter);
+    jitters[ngraph::opset1::Multiply::type_info] = CREATE_EMITTER(jit_multiply_emitter);
+    jitters[ngraph::opset1::Divide::type_info] = CREATE_EMITTER(jit_divide_emitter);
+    jitters[ngraph::opset1::Maximum::type_info] = CREATE_EMITTER(jit_maximum_emitter);
+    jitters[ngraph::opset1::Minimum::type_info] = CREATE_EMITTER(jit_minimum_emitter);
+    jitters[ngraph::opset1::Mod::type_info] = CREATE_EMITTER(jit_mod_emitter);
+    jitters[ngraph::opset1::FloorMod::type_info] = CREATE_EMITTER(jit_floor_mod_emitter);
+    jitters[ngraph::opset1::SquaredDifference::type_info] = CREATE_EMITTER(jit_squared_difference_emitter);
+    jitters[ngraph::opset1::Power::type_info] = CREATE_EMITTER(jit_power_dynamic_emitter);
+    jitters[ngraph::snippets::op::PowerStatic::type_info] = CREATE_EMITTER(jit_power_static_emitter);
+    jitters[ngraph::opset1::Equal::type_info] = CREATE_EMITTER(jit_equal_emitter);
+    jitters[ngraph::opset1::NotEqual::type_info] = CREATE_EMITTER(jit_not_equal_emitter);
+    jitters[ngraph::opset1::Greater::type_info] = CREATE_EMITTER(jit_greater_emitter);
+    jitters[ngraph::opset1::GreaterEqual::type_info] = CREATE_EMITTER(jit_greater_equal_emitter);
+    jitters[ngraph::opset1::Less::type_info] = CREATE_EMITTER(jit_less_emitter);
+    jitters[ngraph::opset1::LessEqual::type_info] = CREATE_EMITTER(jit_less_equal_emitter);
+    jitters[ngraph::opset1::LogicalAnd::type_info] = CREATE_EMITTER(jit_logical_and_emitter);
+    jitters[ngraph::opset1::LogicalOr::type_info] = CREATE_EMITTER(jit_logical_or_emitter);
+    jitters[ngraph::opset1::LogicalXor::type_info] = CREATE_EMITTER(jit_logical_xor_emitter);
+    jitters[ngraph::op::v0::Xor::type_info] = CREATE_EMITTER(jit_logical_xor_emitter);
+    jitters[ngraph::opset1::PRelu::type_info] = CREATE_EMITTER(jit_prelu_emitter);
+
+    // unary
+    jitters[ngraph::opset1::LogicalNot::type_info] = CREATE_EMITTER(jit_logical_not_emitter);
+    jitters[ngraph::opset1::Sqrt::type_info] = CREATE_EMITTER(jit_sqrt_emitter);
+    jitters[ngraph::opset1::Negative::type_info] = CREATE_EMITTER(jit_negative_emitter);
+    jitters[ngraph::opset1::Relu::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Sigmoid::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Tanh::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Exp::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Abs::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Elu::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+    jitters[ngraph::opset1::Clamp::type_info] = CREATE_EMITTER(jit_mkldnn_aux_emitter);
+
+    return jitters;
+}
+
+#undef CREATE_EMITTER
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : h(new jit_snippet()), isa(isa) {
+    CPUTargetMachine target(h.get(), isa);
+    jitters = target.getJitters();
+}
+
+ngraph::snippets::code CPUGenerator::generate(std::shared_ptr<ngraph::Function>& f) const {
+    if (!one_of(isa, avx2, avx512_common))
+        THROW_IE_EXCEPTION << "Snippets code generation is supported only for AVX2 and AVX512 targets";
+
+    // R8-R15 keep data pointers of inputs and outputs followed by the work amount, see AssignRegisters
+    const size_t num_ptrs = f->get_parameters().size() + f->get_results().size();
+    if (num_ptrs + 1 > 8)
+        THROW_IE_EXCEPTION << "Snippet " << f->get_friendly_name() << " has too many inputs and outputs: " << num_ptrs;
+
+    // tail is processed by the same body which loads and stores a single element
+    auto tail = ngraph::clone_function(*f);
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
+    manager.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    manager.run_passes(tail);
+
+    using lowered_op = std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>;
+    auto lower = [this](const std::shared_ptr<ngraph::Function>& body) {
+        std::vector<lowered_op> lowered;
+        for (auto n : body->get_ordered_ops()) {
+            if (ngraph::is_type<ngraph::opset1::Parameter>(n) || ngraph::is_type<ngraph::opset1::Result>(n))
+                continue;
+
+            auto jitter = jitters.find(n->get_type_info());
+            if (jitter == jitters.end())
+                THROW_IE_EXCEPTION << "Operation " << n->get_friendly_name() << " of type " << n->get_type_name()
+                                   << " isn't supported by snippets CPU code generator";
+            lowered.emplace_back(jitter->second(n), ngraph::snippets::getRegisters(n));
+        }
+        return lowered;
+    };
+    const auto vector_body = lower(f);
+    const auto scalar_body = lower(tail);
+
+    // vector registers which don't keep values of the body are free for emitters
+    std::set<size_t> used_vecs;
+    for (const auto& op : vector_body) {
+        used_vecs.insert(op.second.first.begin(), op.second.first.end());
+        used_vecs.insert(op.second.second.begin(), op.second.second.end());
+    }
+    const size_t max_vecs = isa == avx512_common ? 32 : 16;
+    std::vector<size_t> pool_vec;
+    for (size_t idx = 0; idx < max_vecs; idx++) {
+        if (used_vecs.find(idx) == used_vecs.end())
+            pool_vec.push_back(idx);
+    }
+
+    const Reg64 reg_work_amount(static_cast<int>(8 + num_ptrs));
+    // arguments aren't used after the data pointers are loaded, rbx and rbp are saved by preamble
+    std::vector<size_t> pool_gpr {static_cast<size_t>(h->rbx.getIdx()), static_cast<size_t>(h->rbp.getIdx()),
+                                  static_cast<size_t>(abi_param1.getIdx()), static_cast<size_t>(abi_param2.getIdx())};
+    for (size_t idx = reg_work_amount.getIdx() + 1; idx <= Operand::R15; idx++)
+        pool_gpr.push_back(idx);
+
+    auto emit = [&](const std::vector<lowered_op>& body) {
+        for (const auto& op : body)
+            op.first->emit_code(op.second.first, op.second.second, pool_vec, pool_gpr);
+    };
+
+    h->preamble();
+
+    h->mov(reg_work_amount, abi_param2);
+    for (size_t i = 0; i < num_ptrs; i++)
+        h->mov(Reg64(static_cast<int>(8 + i)), h->ptr[abi_param1 + i * sizeof(void*)]);
+
+    const size_t vlen = isa == avx512_common ? 64 : 32;
+    const size_t lanes = vlen / sizeof(float);
+
+    Label vector_loop, tail_loop, exit;
+    h->L(vector_loop);
+    {
+        h->cmp(reg_work_amount, lanes);
+        h->jl(tail_loop, jit_generator::T_NEAR);
+
+        emit(vector_body);
+
+        h->sub(reg_work_amount, lanes);
+        h->jmp(vector_loop, jit_generator::T_NEAR);
+    }
+
+    h->L(tail_loop);
+    {
+        h->cmp(reg_work_amount, 1);
+        h->jl(exit, jit_generator::T_NEAR);
+
+        emit(scalar_body);
+
+        h->sub(reg_work_amount, 1);
+        h->jmp(tail_loop, jit_generator::T_NEAR);
+    }
+
+    h->L(exit);
+    h->postamble();
+
+    for (const auto& op : vector_body)
+        op.first->emit_data();
+    for (const auto& op : scalar_body)
+        op.first->emit_data();
+
+    h->create_kernel();
+    return h->jit_ker();
+}
+
+} // namespace MKLDNNPlugin
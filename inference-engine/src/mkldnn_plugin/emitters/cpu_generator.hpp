@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <cpu/x64/jit_generator.hpp>
+#include "snippets/generator.hpp"
+
+namespace MKLDNNPlugin {
+
+class jit_snippet : public mkldnn::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    ~jit_snippet() = default;
+
+    jit_snippet() : jit_generator() {}
+
+    // the code is emitted by CPUGenerator right into the buffer of this generator
+    void generate() override {}
+};
+
+/**
+ * Provides emitters of the plugin for the operations of the snippets dialect and layout-oblivious operations of opset1.
+ */
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    CPUTargetMachine(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t host_isa);
+
+    auto getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                  std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> override;
+
+private:
+    mkldnn::impl::cpu::x64::jit_generator* h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+/**
+ * Generates x86-64 code for a snippet body in the canonical form.
+ * Generated kernel has the signature void(const void* args[], int64_t work_amount) and processes work_amount elements
+ * of the innermost dimension: data pointers of inputs and then outputs are passed in args. The body is emitted twice:
+ * as a vector loop and as a scalar loop for the tail.
+ */
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() = default;
+
+    ngraph::snippets::code generate(std::shared_ptr<ngraph::Function>& f) const override;
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+} // namespace MKLDNNPlugin
@@ -124,12 +124,13 @@ void jit_emitter::emitter_preamble(const std::vector<size_t> &in_idxs, const std
         aux_gpr_idxs.push_back(_idx);
         preserved_gpr_idxs.push_back(_idx);
     }
-    assert(aux_gpr_idxs.size() == aux_gprs_count());
+    // the pool may be larger than the emitter needs (e.g. the whole set of free gprs of a snippet kernel)
+    assert(aux_gpr_idxs.size() >= aux_gprs_count());
 
     if (!entry_map_.empty()) {
         // last aux_gpr_idx is for p_table, we can use aux_gpr_idxs from idx 0 for other purpose
         p_table = Reg64(aux_gpr_idxs[aux_gprs_count() - 1]);
-        aux_gpr_idxs.erase(aux_gpr_idxs.end() - 1);
+        aux_gpr_idxs.erase(aux_gpr_idxs.begin() + aux_gprs_count() - 1);
     }
 
     for (size_t i = 0; i < preserved_gpr_idxs.size(); ++i)
@@ -0,0 +1,232 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+namespace {
+size_t get_effective_address(const std::shared_ptr<ngraph::Node>& n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        THROW_IE_EXCEPTION << "Snippet operation " << n->get_friendly_name() << " has no assigned data pointer register";
+    auto ea = ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second);
+    if (!ea)
+        THROW_IE_EXCEPTION << "Snippet operation " << n->get_friendly_name() << " has incorrect data pointer register info";
+    return static_cast<size_t>(ea->get());
+}
+
+bool is_innermost_broadcasted(const ngraph::Shape& shape) {
+    return !shape.empty() && shape.back() == 1;
+}
+} // namespace
+
+/// MEMORY ///
+jit_snippets_memory_emitter::jit_snippets_memory_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+: jit_emitter(host, host_isa, n) {
+    reg_ptr = Reg64(static_cast<int>(get_effective_address(n)));
+}
+
+/// LOAD ///
+jit_snippets_load_emitter::jit_snippets_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+: jit_snippets_memory_emitter(host, host_isa, n) {
+    post_increment = !is_innermost_broadcasted(n->get_input_shape(0));
+}
+
+void jit_snippets_load_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                          const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                          const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_load_emitter::emit_isa(const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    if (post_increment) {
+        h->uni_vmovups(vmm_dst, h->ptr[reg_ptr]);
+        h->add(reg_ptr, get_vec_length());
+    } else {
+        // the innermost dimension has a single element, so reading a whole vector would go out of the tensor
+        h->uni_vbroadcastss(vmm_dst, h->ptr[reg_ptr]);
+    }
+}
+
+/// SCALAR LOAD ///
+jit_snippets_scalar_load_emitter::jit_snippets_scalar_load_emitter(jit_generator *host, cpu_isa_t host_isa,
+                                                                   const std::shared_ptr<ngraph::Node>& n)
+: jit_snippets_memory_emitter(host, host_isa, n) {
+    post_increment = !is_innermost_broadcasted(n->get_input_shape(0));
+}
+
+void jit_snippets_scalar_load_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                                 const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                                 const emitter_context *emit_context) const {
+    h->uni_vmovss(Xmm(out_idxs[0]), h->ptr[reg_ptr]);
+    if (post_increment)
+        h->add(reg_ptr, sizeof(float));
+}
+
+/// BROADCAST LOAD ///
+jit_snippets_broadcast_load_emitter::jit_snippets_broadcast_load_emitter(jit_generator *host, cpu_isa_t host_isa,
+                                                                         const std::shared_ptr<ngraph::Node>& n)
+: jit_snippets_memory_emitter(host, host_isa, n) {
+    post_increment = false;
+}
+
+void jit_snippets_broadcast_load_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                                    const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                                    const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_broadcast_load_emitter::emit_isa(const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vbroadcastss(Vmm(out_idxs[0]), h->ptr[reg_ptr]);
+}
+
+/// STORE ///
+jit_snippets_store_emitter::jit_snippets_store_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+: jit_snippets_memory_emitter(host, host_isa, n) {
+    post_increment = !is_innermost_broadcasted(n->get_output_shape(0));
+}
+
+void jit_snippets_store_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                           const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                           const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_store_emitter::emit_isa(const std::vector<size_t> &in_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    if (post_increment) {
+        h->uni_vmovups(h->ptr[reg_ptr], Vmm(in_idxs[0]));
+        h->add(reg_ptr, get_vec_length());
+    } else {
+        h->uni_vmovss(h->ptr[reg_ptr], Xmm(in_idxs[0]));
+    }
+}
+
+/// SCALAR STORE ///
+jit_snippets_scalar_store_emitter::jit_snippets_scalar_store_emitter(jit_generator *host, cpu_isa_t host_isa,
+                                                                     const std::shared_ptr<ngraph::Node>& n)
+: jit_snippets_memory_emitter(host, host_isa, n) {
+    post_increment = !is_innermost_broadcasted(n->get_output_shape(0));
+}
+
+void jit_snippets_scalar_store_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                                  const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                                  const emitter_context *emit_context) const {
+    h->uni_vmovss(h->ptr[reg_ptr], Xmm(in_idxs[0]));
+    if (post_increment)
+        h->add(reg_ptr, sizeof(float));
+}
+
+/// BROADCAST MOVE ///
+jit_snippets_broadcast_move_emitter::jit_snippets_broadcast_move_emitter(jit_generator *host, cpu_isa_t host_isa,
+                                                                         const std::shared_ptr<ngraph::Node>& n)
+: jit_emitter(host, host_isa, n) {
+    // broadcasting by outer dimensions is done by the caller, only the innermost one needs a real broadcast
+    broadcast_innermost = is_innermost_broadcasted(n->get_input_shape(0)) && !is_innermost_broadcasted(n->get_output_shape(0));
+}
+
+void jit_snippets_broadcast_move_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                                    const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                                    const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_broadcast_move_emitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Xmm xmm_src = Xmm(in_idxs[0]);
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    if (broadcast_innermost) {
+        h->uni_vbroadcastss(vmm_dst, xmm_src);
+    } else if (in_idxs[0] != out_idxs[0]) {
+        h->uni_vmovups(vmm_dst, Vmm(in_idxs[0]));
+    }
+}
+
+/// SCALAR ///
+jit_snippets_scalar_emitter::jit_snippets_scalar_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+: jit_emitter(host, host_isa, n) {
+    // snippets::op::Scalar is a Constant, but it doesn't share Constant's type info
+    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(n);
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        THROW_IE_EXCEPTION << "Snippet operation " << n->get_friendly_name() << " isn't a scalar constant";
+    value = constant->cast_vector<float>()[0];
+
+    prepare_table();
+}
+
+void jit_snippets_scalar_emitter::register_table_entries() {
+    push_arg_entry_of("scalar", float2int(value), true);
+}
+
+void jit_snippets_scalar_emitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                            const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                            const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_snippets_scalar_emitter::emit_isa(const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vmovups(Vmm(out_idxs[0]), table_val("scalar"));
+}
+
+} // namespace MKLDNNPlugin
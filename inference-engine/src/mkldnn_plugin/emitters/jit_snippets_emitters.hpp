@@ -0,0 +1,149 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+#include "jit_emitter.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Emitters for the memory access and auxiliary operations of the snippets dialect.
+ * Data pointers live in general purpose registers assigned by snippets::pass::AssignRegisters
+ * (rt_info "effectiveAddress"), vector registers come from "reginfo".
+ * Load and Store move their pointer forward after every access unless the innermost dimension of
+ * the tensor is broadcasted, so the kernel is called for a single row of the innermost dimension.
+ */
+class jit_snippets_memory_emitter : public jit_emitter {
+public:
+    jit_snippets_memory_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                                const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+protected:
+    Xbyak::Reg64 reg_ptr;
+    bool post_increment = true;
+};
+
+class jit_snippets_load_emitter : public jit_snippets_memory_emitter {
+public:
+    jit_snippets_load_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                              const std::shared_ptr<ngraph::Node>& n);
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &out_idxs) const;
+};
+
+class jit_snippets_scalar_load_emitter : public jit_snippets_memory_emitter {
+public:
+    jit_snippets_scalar_load_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                                     const std::shared_ptr<ngraph::Node>& n);
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+};
+
+class jit_snippets_broadcast_load_emitter : public jit_snippets_memory_emitter {
+public:
+    jit_snippets_broadcast_load_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                                        const std::shared_ptr<ngraph::Node>& n);
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &out_idxs) const;
+};
+
+class jit_snippets_store_emitter : public jit_snippets_memory_emitter {
+public:
+    jit_snippets_store_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                               const std::shared_ptr<ngraph::Node>& n);
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs) const;
+};
+
+class jit_snippets_scalar_store_emitter : public jit_snippets_memory_emitter {
+public:
+    jit_snippets_scalar_store_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                                      const std::shared_ptr<ngraph::Node>& n);
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+};
+
+class jit_snippets_broadcast_move_emitter : public jit_emitter {
+public:
+    jit_snippets_broadcast_move_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                                        const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const;
+
+    bool broadcast_innermost = false;
+};
+
+class jit_snippets_scalar_emitter : public jit_emitter {
+public:
+    jit_snippets_scalar_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                                const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &out_idxs) const;
+
+    void register_table_entries() override;
+
+    float value = 0.f;
+};
+
+class jit_snippets_nop_emitter : public jit_emitter {
+public:
+    jit_snippets_nop_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                             const std::shared_ptr<ngraph::Node>& n)
+        : jit_emitter(host, host_isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override {}
+};
+
+} // namespace MKLDNNPlugin
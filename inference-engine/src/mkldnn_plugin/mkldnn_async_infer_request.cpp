@@ -3,13 +3,34 @@
 //
 
 #include "mkldnn_async_infer_request.h"
+#include <iterator>
 #include <memory>
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
+                                                               const InferenceEngine::ITaskExecutor::Ptr& preprocessingExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _inferRequest(static_cast<MKLDNNInferRequest*>(inferRequest.get())) {
+    _inferRequest->SetAsyncRequest(this);
+
+    // Pre-processing has its own stage, so it overlaps with inference of other requests instead of
+    // delaying the inference stream. Synchronous pipeline still runs both parts in InferImpl().
+    // Without the pre-processing executor the default single stage pipeline is kept
+    if (preprocessingExecutor) {
+        _pipeline = {
+            {preprocessingExecutor, [this] { _inferRequest->Preprocess(); }},
+            {taskExecutor, [this] { _inferRequest->InferPreprocessed(); }}
+        };
+    }
+}
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    // Requests without pre-processing don't pay for the switch to the pre-processing executor
+    auto firstStage = _pipeline.begin();
+    if (_pipeline.size() > 1 && !_inferRequest->HasPreprocessing())
+        firstStage = std::next(firstStage);
+    RunFirstStage(firstStage, _pipeline.end(), _callbackExecutor);
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
@@ -15,8 +15,15 @@ class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadS
 public:
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
+                            const InferenceEngine::ITaskExecutor::Ptr &preprocessingExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest() override;
+
+protected:
+    void StartAsync_ThreadUnsafe() override;
+
+private:
+    MKLDNNInferRequest* _inferRequest;
 };
 
 }  // namespace MKLDNNPlugin
@@ -11,6 +11,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_graph_dumper.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
@@ -23,12 +24,50 @@
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <fstream>
+#include <iostream>
 #include <legacy/details/ie_cnn_network_tools.h>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+struct MKLDNNExecNetwork::PrioritizedExecutor : public IStreamsExecutor {
+    explicit PrioritizedExecutor(const IStreamsExecutor::Ptr& executor) : _executor{executor} {}
+
+    void run(Task task) override {
+        auto deadline = _deadline.load();
+        _executor->run(std::move(task), _priority.load(), deadline == 0
+            ? std::chrono::steady_clock::time_point::max()
+            : std::chrono::steady_clock::now() + std::chrono::milliseconds(deadline));
+    }
+
+    void run(Task task, Priority priority, std::chrono::steady_clock::time_point deadline) override {
+        _executor->run(std::move(task), priority, deadline);
+    }
+
+    void Execute(Task task) override {
+        _executor->Execute(std::move(task));
+    }
+
+    int GetStreamId() override {
+        return _executor->GetStreamId();
+    }
+
+    int GetNumaNodeId() override {
+        return _executor->GetNumaNodeId();
+    }
+
+    void update(const Config& config) {
+        _priority = config.modelPriority;
+        _deadline = config.modelDeadline;
+    }
+
+    IStreamsExecutor::Ptr   _executor;
+    std::atomic<Priority>   _priority = {Priority::MEDIUM};
+    std::atomic_int         _deadline = {0};
+};
+
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
@@ -98,6 +137,30 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    if (_cfg.dynamicQuantization != Config::DynamicQuantizationMode::Disabled) {
+        // Dynamic quantization replaces offline calibration, so networks that already contain FakeQuantize are left as is.
+        // FullyConnected nodes check the rest of the conditions (FP32 precision, constant weights, supported ISA) themselves.
+        bool isFloatModel = true;
+        CNNNetworkIterator iter(_clonedNetwork);
+        while (iter != CNNNetworkIterator()) {
+            if (CaselessEq<std::string>()((*iter)->type, "FakeQuantize")) {
+                isFloatModel = false;
+                break;
+            }
+            iter++;
+        }
+
+        if (isFloatModel) {
+            const std::string mode = _cfg.dynamicQuantization == Config::DynamicQuantizationMode::PerRow ? "per_row" : "per_tensor";
+            CNNNetworkIterator fcIter(_clonedNetwork);
+            while (fcIter != CNNNetworkIterator()) {
+                if ((*fcIter)->type == "FullyConnected")
+                    (*fcIter)->params["dynamic_quantization"] = mode;
+                fcIter++;
+            }
+        }
+    }
+
     OV_ITT_TASK_NEXT(taskChain, "createConstInputs");
     auto createConstInputTo = [&](CNNLayerPtr layer, Blob::Ptr blob, const std::vector<size_t>& shape, const std::string& name) {
         LayerParams attrs = {layer->name + "_const_" + name, "Const", blob->getTensorDesc().getPrecision()};
@@ -230,8 +293,20 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        if (_cfg.prioritizedExecution) {
+            // networks with priorities share the executor, so their tasks are ordered in the single queue
+            streamsExecutorConfig._name = "CPUPrioritizedStreamsExecutor";
+            _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamsExecutorConfig);
+        } else {
+            streamsExecutorConfig._name = "CPUStreamsExecutor";
+            _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        }
+    }
+    auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(_taskExecutor);
+    if (nullptr != streamsExecutor) {
+        _prioritizedExecutor = std::make_shared<PrioritizedExecutor>(streamsExecutor);
+        _prioritizedExecutor->update(_cfg);
+        _taskExecutor = _prioritizedExecutor;
     }
     if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
@@ -239,6 +314,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    // A stream per inference stream, so pre-processing of one request overlaps with inference of another one
+    // and resize/color conversion never occupy inference streams. Exclusive requests run one at a time
+    // in the single queue, so their pre-processing stays in the same task as inference
+    if (!cfg.exclusiveAsyncRequests) {
+        _preprocessingExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUPreprocessingExecutor", std::max(1, _cfg.streamExecutorConfig._streams), 0,
+                                     IStreamsExecutor::ThreadBindingType::NONE});
+    }
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
@@ -258,19 +341,17 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
     if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
+        for (auto &node : GetGraph()._graph.GetMemoryInputNodes()) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto state_store = memoryNode->getStore();
+            auto state_name = memoryNode->getId();
+
+            // Remove suffix with pair ID. Internal information.
+            auto suffix_idx = state_name.find("/id=");
+            if (suffix_idx != std::string::npos)
+                state_name = state_name.substr(0, suffix_idx);
+
+            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
         }
     }
 }
@@ -310,6 +391,34 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    if (_cfg.dumpDetailedPerf.empty())
+        return;
+
+    std::vector<const MKLDNNGraph*> graphs;
+    for (auto& g : _graphs) {
+        if (g.IsReady())
+            graphs.push_back(&g);
+    }
+    // Profiling must not break the application, so the report is skipped with a message if it can't be written
+    const auto &path = _cfg.dumpDetailedPerf;
+    try {
+        std::ofstream out(path);
+        if (!out.is_open()) {
+            std::cerr << "[CPU] Cannot open the detailed perf report " << path << std::endl;
+            return;
+        }
+        dump_detailed_perf_as_json(graphs, out);
+        out.flush();
+        if (!out)
+            std::cerr << "[CPU] Failed to write the detailed perf report " << path << std::endl;
+    } catch (const std::exception &e) {
+        std::cerr << "[CPU] Failed to write the detailed perf report " << path << ": " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "[CPU] Failed to write the detailed perf report " << path << std::endl;
+    }
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -323,8 +432,43 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     }
 }
 
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config) {
+    if (config.empty()) {
+        THROW_IE_EXCEPTION << "The list of configuration values is empty";
+    }
+    std::map<std::string, std::string> properties;
+    for (auto&& entry : config) {
+        if (entry.first != PluginConfigParams::KEY_MODEL_PRIORITY && entry.first != PluginConfigParams::KEY_MODEL_DEADLINE) {
+            THROW_IE_EXCEPTION << "The following config value cannot be changed dynamically for ExecutableNetwork: "
+                               << entry.first;
+        }
+        properties.emplace(entry.first, entry.second.as<std::string>());
+    }
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        // A network loaded without priority keys runs on its own executor, so the priority would never compete
+        if (!_cfg.prioritizedExecution) {
+            THROW_IE_EXCEPTION << "The network should be loaded with " << PluginConfigParams::KEY_MODEL_PRIORITY << " or "
+                               << PluginConfigParams::KEY_MODEL_DEADLINE << " to change them dynamically";
+        }
+    }
+    setProperty(properties);
+    if (nullptr != _prioritizedExecutor) {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        _prioritizedExecutor->update(_cfg);
+    }
+}
+
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor,
+                                                                      _preprocessingExecutor, _callbackExecutor);
+    InferenceEngine::IInferRequest::Ptr asyncRequest = std::make_shared<InferenceEngine::InferRequestBase>(asyncRequestImpl);
+    asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
+
+    return asyncRequest;
 }
 
 InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
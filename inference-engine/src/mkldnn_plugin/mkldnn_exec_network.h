@@ -32,10 +32,12 @@ public:
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
 
-    ~MKLDNNExecNetwork() override = default;
+    ~MKLDNNExecNetwork() override;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -61,6 +63,11 @@ protected:
             Graph&                          _graph;
         };
     };
+    // Starts inference tasks with the network priority and deadline
+    struct PrioritizedExecutor;
+    std::shared_ptr<PrioritizedExecutor>        _prioritizedExecutor;
+    // Runs input pre-processing stage of asynchronous requests, nullptr for exclusive async requests
+    InferenceEngine::ITaskExecutor::Ptr         _preprocessingExecutor;
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
@@ -35,6 +35,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include "ie_parallel.hpp"
 
 #include "utils/blob_dump.h"
 #include "utils/general_utils.h"
@@ -347,12 +348,24 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitParallelLevels();
+
     Allocate();
 
     CreatePrimitives();
 
+    memoryInputNodes.clear();
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput)
+            memoryInputNodes.push_back(node);
+    }
+
     SetOriginalLayerNames();
 
+    // Shapes and weights are released by cleanup, so the workload is estimated in advance
+    if (!config.dumpDetailedPerf.empty())
+        InitDetailedPerfCounters();
+
     if (!config.dumpToDot.empty())
         dumpToDotFile(config.dumpToDot + "_init.dot");
 
@@ -648,8 +661,9 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // Nodes of one level may be executed at the same time, so their tensors must not share memory
+            int e_start = execLevels.empty() ? edge->getParent()->execIndex : execLevels[edge->getParent()->execIndex];
+            int e_finish = execLevels.empty() ? edge->getChild()->execIndex : execLevels[edge->getChild()->execIndex];
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -729,6 +743,55 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::InitParallelLevels() {
+    parallelLevels.clear();
+    execLevels.clear();
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.enableInterOpParallelism)
+        return;
+
+    // The order of memory state nodes is defined by their pairing, not by edges
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    // graphNodes are sorted topologically, so levels of parents are known before the node is visited.
+    // Constant nodes are executed once on load and don't delay their consumers.
+    std::vector<int> levels(graphNodes.size(), 0);
+    std::vector<std::vector<MKLDNNNodePtr>> nodesByLevel;
+    for (auto &node : graphNodes) {
+        int level = 0;
+        if (!node->isConstant()) {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                auto parent = node->getParentEdgeAt(i)->getParent();
+                if (!parent->isConstant())
+                    level = std::max(level, levels[parent->execIndex] + 1);
+            }
+            if (nodesByLevel.size() <= static_cast<size_t>(level))
+                nodesByLevel.resize(level + 1);
+            nodesByLevel[level].push_back(node);
+        }
+        levels[node->execIndex] = level;
+    }
+
+    // Concurrent execution needs more memory, so it's enabled only if there are independent nodes doing some work
+    bool hasBranches = false;
+    for (const auto &level : nodesByLevel) {
+        size_t working = std::count_if(level.begin(), level.end(), [](const MKLDNNNodePtr &node) {
+            return node->getType() != Input && node->getType() != Output;
+        });
+        hasBranches = hasBranches || working > 1;
+    }
+    if (!hasBranches)
+        return;
+
+    parallelLevels = std::move(nodesByLevel);
+    execLevels = std::move(levels);
+#endif
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -844,28 +907,57 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (request != nullptr) {
-            request->ThrowIfCanceled();
-        }
-
-        PERF(graphNodes[i]);
-
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+    if (parallelLevels.empty()) {
+        for (int i = 0; i < graphNodes.size(); i++) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+            ExecuteNode(graphNodes[i], stream, batch);
+        }
+    } else {
+        for (const auto &level : parallelLevels) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+            if (level.size() == 1) {
+                ExecuteNode(level[0], stream, batch);
+                continue;
+            }
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+            // Nodes are picked up dynamically by the threads of the stream arena,
+            // parallel loops inside the nodes are served by the rest of the threads
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, level.size(), 1), [&](const tbb::blocked_range<size_t> &range) {
+                mkldnn::stream nodeStream(eng);
+                for (size_t i = range.begin(); i != range.end(); i++)
+                    ExecuteNode(level[i], nodeStream, batch);
+            });
+#else
+            for (const auto &node : level)
+                ExecuteNode(node, stream, batch);
+#endif
         }
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr &node, mkldnn::stream &stream, int batch) {
+    PERF(node);
+
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
+
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+        node->execute(stream);
+    }
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -984,6 +1076,77 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
+void MKLDNNGraph::InitDetailedPerfCounters() {
+    auto tensorSize = [](const MKLDNNEdgePtr &edge) -> uint64_t {
+        auto desc = edge->getDesc();
+        return edge->getDims().size() * (desc.getPrecision() == Precision::BIN ? 1 : desc.getPrecision().size());
+    };
+
+    for (auto &node : graphNodes) {
+        auto &counter = node->PerfCounter();
+        counter.enableDetailed();
+        if (node->isConstant())
+            continue;
+
+        counter.bytesRead = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            counter.bytesRead += tensorSize(node->getParentEdgeAt(i));
+        for (auto &blob : node->internalBlobs)
+            counter.bytesRead += blob->byteSize();
+
+        // Edges of one output port share the memory
+        counter.bytesWritten = 0;
+        std::unordered_set<int> ports;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            if (ports.insert(edge->getInputNum()).second)
+                counter.bytesWritten += tensorSize(edge);
+        }
+
+        if (node->getChildEdges().empty())
+            continue;
+
+        uint64_t dstElems = node->getChildEdgeAt(0)->getDims().size();
+        // Weights are either internal blobs or the second input of the node
+        uint64_t weightsElems = 0;
+        if (!node->internalBlobs.empty())
+            weightsElems = node->internalBlobs[0]->size();
+        else if (node->getParentEdges().size() > 1)
+            weightsElems = node->getParentEdgeAt(1)->getDims().size();
+
+        // Multiply-add is counted as two operations, fused post ops as one per output element
+        uint64_t flops = dstElems * node->fusedWith.size();
+        switch (node->getType()) {
+            case Convolution:
+            case BinaryConvolution:
+            case DeformableConvolution:
+            case FullyConnected: {
+                auto &dstDims = node->getChildEdgeAt(0)->getDims();
+                uint64_t oc = dstDims.ndims() > 1 ? dstDims[1] : 1;
+                flops += 2 * dstElems * (weightsElems / oc);
+                break;
+            }
+            case Deconvolution: {
+                auto &srcDims = node->getParentEdgeAt(0)->getDims();
+                uint64_t ic = srcDims.ndims() > 1 ? srcDims[1] : 1;
+                flops += 2 * srcDims.size() * (weightsElems / ic);
+                break;
+            }
+            case Gemm: {
+                auto &srcDims = node->getParentEdgeAt(0)->getDims();
+                bool transposeA = node->getCnnLayer() && node->getCnnLayer()->GetParamAsBool("transpose_a", false);
+                uint64_t k = srcDims.ndims() < 2 ? srcDims.size() : srcDims[srcDims.ndims() - (transposeA ? 2 : 1)];
+                flops += 2 * dstElems * k;
+                break;
+            }
+            default:
+                flops += dstElems;
+                break;
+        }
+        counter.flops = flops;
+    }
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -81,6 +81,10 @@ public:
         return inputNodes;
     }
 
+    const std::vector<MKLDNNNodePtr>& GetMemoryInputNodes() const {
+        return memoryInputNodes;
+    }
+
 
     mkldnn::engine getEngine() const {
         return eng;
@@ -170,7 +174,10 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        memoryInputNodes.clear();
         _meanImages.clear();
+        parallelLevels.clear();
+        execLevels.clear();
     }
     Status status { NotReady };
     Config config;
@@ -187,6 +194,15 @@ protected:
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
+    // MemoryInput nodes in the execution order. Variable states of the infer requests are kept in the same order,
+    // so they are bound to the graph without lookups by name.
+    std::vector<MKLDNNNodePtr> memoryInputNodes;
+
+    // Nodes grouped by the length of the longest path from graph inputs. Nodes of one level don't depend
+    // on each other and are executed concurrently. Empty if the graph is executed node by node.
+    std::vector<std::vector<MKLDNNNodePtr>> parallelLevels;
+    // Level of every node indexed by execIndex, used to plan memory for the concurrent execution
+    std::vector<int> execLevels;
 
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
@@ -200,11 +216,14 @@ protected:
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitParallelLevels();
+    void InitDetailedPerfCounters();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
+    void ExecuteNode(const MKLDNNNodePtr &node, mkldnn::stream &stream, int batch);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -213,6 +232,7 @@ protected:
     friend class MKLDNNGraphlessInferRequest;
     friend InferenceEngine::CNNNetwork dump_graph_as_ie_net(const MKLDNNGraph &graph);
     friend InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
+    friend void dump_detailed_perf_as_json(const std::vector<const MKLDNNGraph *> &graphs, std::ostream &out);
 
 private:
     void dumpToDotFile(std::string file) const;
@@ -15,6 +15,10 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <limits>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
 
 using namespace InferenceEngine;
 
@@ -24,6 +28,7 @@ namespace {
 
 std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &);
 void drawer_callback(const InferenceEngine::CNNLayerPtr, ordered_properties &, ordered_properties &);
+std::string json_escape(const std::string &str);
 
 }  // namespace
 
@@ -198,6 +203,83 @@ void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out) {
     InferenceEngine::saveGraphToDot(dump_net, out, drawer_callback);
 }
 
+void dump_detailed_perf_as_json(const std::vector<const MKLDNNGraph *> &graphs, std::ostream &out) {
+    // Timeline starts at the first execution of any stream
+    uint64_t origin = std::numeric_limits<uint64_t>::max();
+    for (auto graph : graphs) {
+        for (auto &node : graph->graphNodes) {
+            auto &samples = node->PerfCounter().getSamples();
+            if (!samples.empty())
+                origin = std::min(origin, samples.front().start);
+        }
+    }
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\n\"displayTimeUnit\": \"ns\",\n\"traceEvents\": [";
+    bool first = true;
+    for (size_t stream = 0; stream < graphs.size(); stream++) {
+        for (auto &node : graphs[stream]->graphNodes) {
+            for (auto &sample : node->PerfCounter().getSamples()) {
+                out << (first ? "\n" : ",\n");
+                out << "{\"name\": \"" << json_escape(node->getName()) << "\", \"cat\": \"" << json_escape(node->getTypeStr())
+                    << "\", \"ph\": \"X\", \"pid\": " << stream << ", \"tid\": " << sample.thread
+                    << ", \"ts\": " << (sample.start - origin) / 1000.0 << ", \"dur\": " << sample.duration / 1000.0 << "}";
+                first = false;
+            }
+        }
+    }
+    out << "\n],\n\"nodes\": [";
+
+    first = true;
+    for (size_t stream = 0; stream < graphs.size(); stream++) {
+        for (auto &node : graphs[stream]->graphNodes) {
+            auto &counter = node->PerfCounter();
+            if (counter.count() == 0)
+                continue;
+
+            std::vector<uint64_t> durations;
+            durations.reserve(counter.getSamples().size());
+            for (auto &sample : counter.getSamples())
+                durations.push_back(sample.duration);
+            auto percentile = [&durations](double p) -> double {
+                if (durations.empty())
+                    return 0.0;
+                auto nth = durations.begin() + static_cast<size_t>(p * (durations.size() - 1));
+                std::nth_element(durations.begin(), nth, durations.end());
+                return *nth / 1000.0;
+            };
+
+            // Bytes and operations per nanosecond are GB/s and GFLOP/s
+            double avgNs = static_cast<double>(counter.avgNs());
+            double bandwidth = avgNs > 0 ? (counter.bytesRead + counter.bytesWritten) / avgNs : 0.0;
+            double performance = avgNs > 0 ? counter.flops / avgNs : 0.0;
+            uint64_t bytes = counter.bytesRead + counter.bytesWritten;
+            double intensity = bytes > 0 ? static_cast<double>(counter.flops) / bytes : 0.0;
+
+            out << (first ? "\n" : ",\n");
+            out << "{\"stream\": " << stream
+                << ", \"name\": \"" << json_escape(node->getName()) << "\""
+                << ", \"type\": \"" << json_escape(node->getTypeStr()) << "\""
+                << ", \"exec_type\": \"" << json_escape(node->getPrimitiveDescriptorType()) << "\""
+                << ", \"count\": " << counter.count()
+                << ", \"avg_us\": " << avgNs / 1000.0
+                << ", \"min_us\": " << counter.minNs() / 1000.0
+                << ", \"max_us\": " << counter.maxNs() / 1000.0
+                << ", \"p50_us\": " << percentile(0.5)
+                << ", \"p90_us\": " << percentile(0.9)
+                << ", \"p99_us\": " << percentile(0.99)
+                << ", \"bytes_read\": " << counter.bytesRead
+                << ", \"bytes_written\": " << counter.bytesWritten
+                << ", \"flops\": " << counter.flops
+                << ", \"gbps\": " << bandwidth
+                << ", \"gflops\": " << performance
+                << ", \"flops_per_byte\": " << intensity << "}";
+            first = false;
+        }
+    }
+    out << "\n]\n}\n";
+}
+
 //**********************************
 // Special converters of meta data
 //**********************************
@@ -322,6 +404,20 @@ void drawer_callback(const InferenceEngine::CNNLayerPtr layer,
     node_properties.push_back({"xlabel", (perf != layer->params.end()) ? perf->second : ""});
 }
 
+std::string json_escape(const std::string &str) {
+    std::ostringstream escaped;
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+        } else {
+            escaped << c;
+        }
+    }
+    return escaped.str();
+}
+
 }  // namespace
 
 }  // namespace MKLDNNPlugin
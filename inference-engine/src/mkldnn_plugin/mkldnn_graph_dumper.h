@@ -8,11 +8,18 @@
 #include "mkldnn_graph.h"
 
 #include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
 void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out);
 
+/**
+ * Writes detailed perf counters of the graphs of all streams as JSON. Executions of nodes are written
+ * as Chrome trace events (one process per stream), statistics of nodes are in the "nodes" array.
+ */
+void dump_detailed_perf_as_json(const std::vector<const MKLDNNGraph *> &graphs, std::ostream &out);
+
 InferenceEngine::CNNNetwork dump_graph_as_ie_net(const MKLDNNGraph &graph);
 InferenceEngine::CNNNetwork dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
 
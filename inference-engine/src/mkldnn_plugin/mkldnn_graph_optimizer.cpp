@@ -17,6 +17,7 @@
 #include <nodes/mkldnn_permute_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 
 #include "mkldnn/ie_mkldnn.h"
 
@@ -641,8 +642,12 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+        if (node->getType() != FullyConnected || node->getChildEdges().size() != 1)
+            return false;
+
+        // Dynamically quantized FullyConnected dequantizes its output itself and doesn't support post ops
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        return fcNode == nullptr || !fcNode->isDynamicallyQuantized();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
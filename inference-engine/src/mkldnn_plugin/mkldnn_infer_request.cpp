@@ -44,24 +44,30 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     // producer as storage for tensor to keep it between infer calls.
     IE_SUPPRESS_DEPRECATED_START
     if (execNetwork->_numRequests > 1 || execNetwork->QueryState().size() == 0) {
-        for (auto &node : graph->GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-           }
+        for (auto &node : graph->GetMemoryInputNodes()) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto state_store = memoryNode->getStore();
+            auto state_name = memoryNode->getId();
+
+            // Remove suffix with pair ID. Internal information.
+            auto suffix_idx = state_name.find("/id=");
+            if (suffix_idx != std::string::npos)
+                state_name = state_name.substr(0, suffix_idx);
+
+            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
         }
     } else {
         memoryStates = execNetwork->QueryState();
     }
     IE_SUPPRESS_DEPRECATED_END
+
+    // States follow the order of MemoryInput nodes, which is the same in the graphs of all streams
+    for (auto &state : memoryStates) {
+        auto variableState = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+        if (!variableState)
+            THROW_IE_EXCEPTION << "Unexpected type of the variable state " << state->GetName();
+        variableStates.push_back(variableState);
+    }
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
@@ -141,45 +147,41 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
+    auto &memoryNodes = graph->GetMemoryInputNodes();
+    if (memoryNodes.size() != variableStates.size())
+        THROW_IE_EXCEPTION << "Graph has " << memoryNodes.size() << " MemoryInput nodes, but the request has "
+                           << variableStates.size() << " variable states";
+
+    for (size_t i = 0; i < memoryNodes.size(); i++) {
+        auto memoryNode = static_cast<MKLDNNMemoryInputNode*>(memoryNodes[i].get());
+        memoryNode->bindState(variableStates[i]->GetCurrent(), variableStates[i]->GetNext());
     }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
-        }
+    for (auto &state : variableStates) {
+        state->Commit();
     }
 }
 
-
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
+    Preprocess();
+    InferPreprocessed();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::Preprocess() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Preprocess");
+
+    ThrowIfCanceled();
+
+    execDataPreprocessing(_inputs);
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::HasPreprocessing() const {
+    return !_preProcData.empty();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferPreprocessed() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
     auto graphLock = execNetwork->GetGraph();
@@ -187,8 +189,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     ThrowIfCanceled();
 
-    execDataPreprocessing(_inputs);
-
     changeDefaultPtr();
 
     ThrowIfCanceled();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_memory_state.h"
 #include <memory>
 #include <string>
 #include <map>
@@ -26,6 +27,21 @@ public:
 
     void InferImpl() override;
 
+    /**
+     * @brief Executes input pre-processing, the first part of InferImpl()
+     */
+    void Preprocess();
+
+    /**
+     * @brief Infers the graph on pre-processed inputs, the second part of InferImpl()
+     */
+    void InferPreprocessed();
+
+    /**
+     * @brief Checks whether any input of the request has pre-processing
+     */
+    bool HasPreprocessing() const;
+
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) override;
@@ -60,6 +76,7 @@ private:
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
+    std::vector<std::shared_ptr<MKLDNNVariableState>> variableStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
@@ -6,24 +6,46 @@
 #include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <string>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
+MKLDNNVariableState::MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
+        name(name) {
+    for (auto &buffer : buffers) {
+        buffer = std::make_shared<MKLDNNMemory>(storage->GetPrimitive().get_engine());
+        buffer->Create(storage->GetDescriptor());
+    }
+    cpu_memcpy(buffers[current]->GetData(), storage->GetData(), storage->GetSize());
+}
+
 std::string  MKLDNNVariableState::GetName() const {
     return name;
 }
 
 void  MKLDNNVariableState::Reset() {
-    std::memset(this->storage->buffer(), 0, storage->byteSize());
+    buffers[current]->FillZero();
 }
 
 void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
-    storage = newState;
+    auto &state = buffers[current];
+    if (newState->byteSize() != state->GetSize())
+        THROW_IE_EXCEPTION << "Cannot set state " << name << ": blob size " << newState->byteSize()
+                           << " doesn't match the state size " << state->GetSize();
+
+    cpu_memcpy(state->GetData(), newState->cbuffer().as<const void*>(), newState->byteSize());
 }
 
 InferenceEngine::Blob::CPtr MKLDNNVariableState::GetState() const {
-    return storage;
+    auto &state = buffers[current];
+    auto blob = make_blob_with_precision(MKLDNNMemoryDesc(state->GetDescriptor()));
+    blob->allocate();
+    cpu_memcpy(blob->buffer(), state->GetData(), std::min(blob->byteSize(), state->GetSize()));
+    return blob;
 }
 
 }  // namespace MKLDNNPlugin
@@ -10,26 +10,43 @@
 #include "nodes/common/cpu_memcpy.h"
 
 #include <string>
+#include <array>
 
 namespace MKLDNNPlugin {
 
+/**
+ * The state keeps two buffers of the graph layout: the current value is read by the graph,
+ * the next one is written by it during inference. They are swapped when inference is finished,
+ * so the data is copied only by explicit GetState/SetState calls.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            name(name) {
-        this->storage = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
-        this->storage->allocate();
-        cpu_memcpy(this->storage->buffer(), storage->GetData(), storage->GetSize());
-    }
+    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage);
 
     std::string GetName() const override;
     void Reset() override;
     void SetState(InferenceEngine::Blob::Ptr newState) override;
     InferenceEngine::Blob::CPtr GetState() const override;
 
+    const MKLDNNMemoryPtr& GetCurrent() const {
+        return buffers[current];
+    }
+
+    const MKLDNNMemoryPtr& GetNext() const {
+        return buffers[current ^ 1];
+    }
+
+    /**
+     * @brief Makes the value produced by the finished inference current
+     */
+    void Commit() {
+        current ^= 1;
+    }
+
 private:
     std::string name;
-    InferenceEngine::Blob::Ptr storage;
+    std::array<MKLDNNMemoryPtr, 2> buffers;
+    size_t current = 0;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
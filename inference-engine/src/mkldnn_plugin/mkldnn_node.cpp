@@ -137,6 +137,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceProd", ReduceProd},
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
+        { "Subgraph", Subgraph},
 };
 
 Type TypeFromName(const std::string type) {
@@ -681,7 +682,9 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
 
     InferenceEngine::TensorDesc desc(blb->getTensorDesc().getPrecision(), dims, intLayout);
 
+    std::vector<InferenceEngine::Blob::CPtr> sources;
     auto fillInternalBlob = [&](char *data, size_t intBuffSize) {
+        sources.push_back(blb);
         size_t offset = blb->byteSize();
         checkSize(intBuffSize, offset);
         cpu_memcpy_s(data, intBuffSize, blb->buffer(), blb->byteSize());
@@ -695,6 +698,7 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
 
             if (blb == nullptr)
                 THROW_IE_EXCEPTION << "Cannot get internal blob layer for node " << getName() << ".";
+            sources.push_back(blb);
             offset += blb->byteSize();
             checkSize(intBuffSize, offset);
             cpu_memcpy_s(data, intBuffSize, blb->buffer(), blb->byteSize());
@@ -719,10 +723,28 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
     size_t intBuffSize = internalBlob->byteSize();
 
     fillInternalBlob(data, intBuffSize);
+    for (auto it = internalBlobSources.begin(); it != internalBlobSources.end();) {
+        if (it->second.blob.expired())
+            it = internalBlobSources.erase(it);
+        else
+            ++it;
+    }
+    internalBlobSources[internalBlob.get()] = {internalBlob, std::move(sources)};
 
     return internalBlob;
 }
 
+uint64_t MKLDNNNode::getInternalBlobHash(const InferenceEngine::Blob::Ptr& blob) const {
+    auto found = internalBlobSources.find(blob.get());
+    if (found == internalBlobSources.end() || found->second.blob.lock() != blob)
+        return MKLDNNWeightsSharing::GetHashFunc().hash(blob->cbuffer().as<const unsigned char *>(), blob->byteSize());
+
+    uint64_t hash = 0;
+    for (const auto &source : found->second.sources)
+        hash ^= weightCache->hashOf(source) + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
 void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::primitive_desc_iterator& itpd) {
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         auto &dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
@@ -759,8 +781,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            const uint64_t data_hash = getInternalBlobHash(internalBlob);
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
@@ -841,6 +862,7 @@ void MKLDNNNode::addOriginalLayer(const InferenceEngine::CNNLayerPtr &layer) {
 
 void MKLDNNNode::cleanup() {
     internalBlobs.clear();
+    internalBlobSources.clear();
     cnnLayer.reset();
 
     for (auto it : fusedWith) {
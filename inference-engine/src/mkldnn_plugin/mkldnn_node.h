@@ -85,7 +85,8 @@ enum Type {
     ReduceOr,
     ReduceProd,
     ReduceSum,
-    ReduceSumSquare
+    ReduceSumSquare,
+    Subgraph
 };
 
 Type TypeFromName(const std::string type);
@@ -200,6 +201,8 @@ static std::string NameFromType(Type type) {
             return "ReduceSum";
         case ReduceSumSquare:
             return "ReduceSumSquare";
+        case Subgraph:
+            return "Subgraph";
         default:
             return "Unknown";
     }
@@ -571,6 +574,12 @@ protected:
     };
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
+    // Constant blobs the internal blobs created by createInternalBlob() are copied from
+    struct InternalBlobSources {
+        std::weak_ptr<const InferenceEngine::Blob> blob;  // an internal blob may be replaced and its address reused
+        std::vector<InferenceEngine::Blob::CPtr> sources;
+    };
+    std::unordered_map<const InferenceEngine::Blob*, InternalBlobSources> internalBlobSources;
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     std::unordered_map<int, mkldnn::memory> primArgs;
@@ -596,6 +605,13 @@ protected:
 
     InferenceEngine::Blob::Ptr createInternalBlob(InferenceEngine::SizeVector dims, bool weights, bool is_grouped = false);
 
+    /**
+     * @brief Auxiliary function to get a hash of the internal blob data for the weights cache key
+     * @return Combined memoized hashes of the constants the blob is copied from, so the data isn't hashed again
+     * for every stream graph. The hash of the blob data for blobs created without createInternalBlob()
+     */
+    uint64_t getInternalBlobHash(const InferenceEngine::Blob::Ptr& blob) const;
+
     InferenceEngine::Layout getWeightsLayoutByDims(InferenceEngine::SizeVector dims, bool isGrouped);
 
     /**
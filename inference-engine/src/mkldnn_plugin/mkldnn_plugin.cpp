@@ -35,6 +35,7 @@
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
 #include <transformations/common_optimizations/depth_to_space_fusion.hpp>
+#include <transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp>
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_space_to_depth.hpp>
 #include <transformations/op_conversions/convert_gelu.hpp>
@@ -71,6 +72,8 @@
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
 
+#include <snippets/pass/collapse_subgraph.hpp>
+
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
 #include <transformations/low_precision/disable_convert_constant_folding_on_const_path.hpp>
@@ -107,7 +110,82 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
+// Mean values, mean images and scales of inputs are converted into Subtract/Multiply operations, so they
+// are folded into a single per-channel operation executed by the graph on the (possibly zero-copy) input
+// instead of a separate scalar pass over the copied input data on every request.
+// The pre-processing info of such inputs is reset, the rest is still handled by MeanImage.
+static void ConvertMeanScaleToOps(CNNNetwork& clonedNetwork) {
+    auto nGraphFunc = clonedNetwork.getFunction();
+
+    for (auto& input : clonedNetwork.getInputsInfo()) {
+        PreProcessInfo &pp = input.second->getPreProcess();
+        const size_t channels = pp.getNumberOfChannels();
+        if (channels == 0)
+            continue;
+
+        auto paramIt = std::find_if(nGraphFunc->get_parameters().begin(), nGraphFunc->get_parameters().end(),
+                                    [&input](const std::shared_ptr<ngraph::opset1::Parameter> &param) {
+                                        return param->get_friendly_name() == input.first;
+                                    });
+        if (paramIt == nGraphFunc->get_parameters().end())
+            continue;
+        auto param = *paramIt;
+        if (!param->get_element_type().is_real() || param->get_partial_shape().is_dynamic())
+            continue;
+        const auto shape = param->get_shape();
+        if (shape.size() != 4 || shape[1] != channels)
+            continue;
+
+        const auto consumers = param->output(0).get_target_inputs();
+        ngraph::Output<ngraph::Node> last = param->output(0);
+
+        const auto variant = pp.getMeanVariant();
+        if (variant == MEAN_VALUE) {
+            std::vector<float> meanValues(channels);
+            for (size_t c = 0; c < channels; c++)
+                meanValues[c] = pp[c]->meanValue;
+            auto mean = ngraph::opset1::Constant::create(param->get_element_type(), ngraph::Shape{1, channels, 1, 1}, meanValues);
+            last = std::make_shared<ngraph::opset1::Subtract>(last, mean)->output(0);
+            last.get_node()->set_friendly_name(input.first + "/mean_values");
+        } else if (variant == MEAN_IMAGE) {
+            const size_t planeSize = shape[2] * shape[3];
+            std::vector<float> meanImage(channels * planeSize);
+            for (size_t c = 0; c < channels; c++) {
+                auto meanBlob = as<MemoryBlob>(pp[c]->meanData);
+                if (!meanBlob || meanBlob->getTensorDesc().getPrecision() != Precision::FP32)
+                    THROW_IE_EXCEPTION << "mean image not provided or not in Float 32";
+                if (meanBlob->size() != planeSize)
+                    THROW_IE_EXCEPTION << "mean image size does not match expected network input, expecting " << shape[3] << " x " << shape[2];
+                auto meanData = meanBlob->rmap().as<const float *>();
+                std::copy(meanData, meanData + planeSize, meanImage.begin() + c * planeSize);
+            }
+            auto mean = ngraph::opset1::Constant::create(param->get_element_type(), ngraph::Shape{1, channels, shape[2], shape[3]}, meanImage);
+            last = std::make_shared<ngraph::opset1::Subtract>(last, mean)->output(0);
+            last.get_node()->set_friendly_name(input.first + "/mean_image");
+        } else if (variant != NONE) {
+            THROW_IE_EXCEPTION << "Unsupported mean variant: " << variant;
+        }
+
+        std::vector<float> scales(channels);
+        for (size_t c = 0; c < channels; c++)
+            scales[c] = pp[c]->stdScale;
+        if (std::any_of(scales.begin(), scales.end(), [](float scale) { return scale != 1.f; })) {
+            auto scale = ngraph::opset1::Constant::create(param->get_element_type(), ngraph::Shape{1, channels, 1, 1}, scales);
+            last = std::make_shared<ngraph::opset1::Multiply>(last, scale)->output(0);
+            last.get_node()->set_friendly_name(input.first + "/scales");
+        }
+
+        for (auto &consumer : consumers)
+            consumer.replace_source_output(last);
+
+        pp.init(0);
+        pp.setVariant(NONE);
+    }
+}
+
 static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+    ConvertMeanScaleToOps(clonedNetwork);
+
     auto nGraphFunc = clonedNetwork.getFunction();
 
     ngraph::pass::Manager manager;
@@ -151,6 +229,8 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         manager.register_pass<ngraph::pass::ConvertPrecision>(precision.first, precision.second);
     }
 
+    manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+
     auto pass_config = manager.get_pass_config();
 
     using const_node_ptr = const std::shared_ptr<const ngraph::Node>;
@@ -214,6 +294,12 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
                 return true;
             });
 
+    // ScaledDotProductAttention node is implemented for FP32 only
+    pass_config->set_callback<ngraph::pass::ScaledDotProductAttentionFusion>(
+            [](const_node_ptr &node) -> bool {
+                return node->get_output_element_type(0) != ngraph::element::f32;
+            });
+
     pass_config->set_callback<ngraph::pass::MVN6Decomposition>(
             [](const_node_ptr &node) -> bool {
                 return MKLDNNMVNNode::checkAxesSuitability(node);
@@ -236,6 +322,9 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     pass_config->enable<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
 
     if (useLpt) {
+        // quantized MatMuls of the attention are handled by low precision transformations
+        pass_config->disable<ngraph::pass::ScaledDotProductAttentionFusion>();
+
         pass_config->set_callback<ngraph::pass::ConvertQuantizeDequantize>([](const_node_ptr &node) -> bool {
             return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForMultiply(node);
         });
@@ -275,6 +364,39 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         transformer.transform(nGraphFunc);
     }
 
+    // Chains of elementwise operations are collapsed into snippets before the legacy conversion decomposes them.
+    // Operations which are fused into convolutions and fully connected layers by the graph optimizer are left as is.
+    if (conf.enableSnippets && with_cpu_x86_avx2()) {
+        OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "TokenizeSnippets");
+
+        ngraph::pass::Manager tokenizationManager;
+        tokenizationManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+        tokenizationManager.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph,
+                                                            ngraph::snippets::pass::AttachToSubgraph>(
+            [](const_node_ptr &node) -> bool {
+                if (ngraph::is_type<ngraph::opset1::Erf>(node))
+                    return true;
+                // per channel slope isn't numpy broadcastable to the data
+                if (ngraph::is_type<ngraph::opset1::PRelu>(node)) {
+                    const auto& slope_shape = node->get_input_shape(1);
+                    if (ngraph::shape_size(slope_shape) != 1 && slope_shape != node->get_input_shape(0))
+                        return true;
+                }
+                for (const auto& input : node->input_values()) {
+                    const auto parent = input.get_node_shared_ptr();
+                    if (ngraph::is_type<ngraph::opset1::Convolution>(parent) ||
+                        ngraph::is_type<ngraph::opset1::GroupConvolution>(parent) ||
+                        ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(parent) ||
+                        ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(parent) ||
+                        ngraph::is_type<ngraph::opset1::MatMul>(parent) ||
+                        ngraph::is_type<ngraph::opset1::FakeQuantize>(parent))
+                        return true;
+                }
+                return false;
+            });
+        tokenizationManager.run_passes(nGraphFunc);
+    }
+
     bool has_fake_quantize = ::ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc);
 
     ngraph::pass::Manager legacyManager;
@@ -5,10 +5,59 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+SimpleDataHash::SimpleDataHash() {
+    for (int i = 0; i < kTableSize; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+        table[0][i] = c;
+    }
+    for (int s = 1; s < kSlices; s++) {
+        for (int i = 0; i < kTableSize; i++)
+            table[s][i] = table[0][table[s - 1][i] & 0xff] ^ (table[s - 1][i] >> 8);
+    }
+}
+
+uint64_t SimpleDataHash::update(uint64_t crc, const unsigned char* data, size_t size) const {
+    size_t idx = 0;
+    for (; idx + kSlices <= size; idx += kSlices) {
+        const unsigned char* d = data + idx;
+        const uint64_t x = crc ^ (static_cast<uint64_t>(d[0])       | static_cast<uint64_t>(d[1]) << 8  |
+                                  static_cast<uint64_t>(d[2]) << 16 | static_cast<uint64_t>(d[3]) << 24 |
+                                  static_cast<uint64_t>(d[4]) << 32 | static_cast<uint64_t>(d[5]) << 40 |
+                                  static_cast<uint64_t>(d[6]) << 48 | static_cast<uint64_t>(d[7]) << 56);
+        crc = table[7][x & 0xff]         ^ table[6][(x >> 8) & 0xff]  ^
+              table[5][(x >> 16) & 0xff] ^ table[4][(x >> 24) & 0xff] ^
+              table[3][(x >> 32) & 0xff] ^ table[2][(x >> 40) & 0xff] ^
+              table[1][(x >> 48) & 0xff] ^ table[0][x >> 56];
+    }
+    for (; idx < size; idx++)
+        crc = table[0][(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+
+    return crc;
+}
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kBlockSize)
+        return ~update(0, data, size);
+
+    const size_t blocks = (size + kBlockSize - 1) / kBlockSize;
+    std::vector<uint64_t> blockCRCs(blocks);
+    InferenceEngine::parallel_for(blocks, [&](size_t block) {
+        const size_t offset = block * kBlockSize;
+        blockCRCs[block] = update(0, data + offset, std::min(kBlockSize, size - offset));
+    });
+
+    return ~update(0, reinterpret_cast<const unsigned char*>(blockCRCs.data()), blocks * sizeof(uint64_t));
+}
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
@@ -71,6 +120,32 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr);
 }
 
+uint64_t MKLDNNWeightsSharing::hashOf(const InferenceEngine::Blob::CPtr& blob) {
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        auto found = blobHashes.find(blob.get());
+        if (found != blobHashes.end() && found->second.blob.lock() == blob)
+            return found->second.hash;
+    }
+
+    // Streams may hash the same blob concurrently, the weights are not locked meanwhile
+    const uint64_t hash = simpleCRC.hash(blob->cbuffer().as<const unsigned char*>(), blob->byteSize());
+
+    std::unique_lock<std::mutex> lock(guard);
+    if (blobHashes.size() >= blobHashesSweepSize) {
+        for (auto it = blobHashes.begin(); it != blobHashes.end();) {
+            if (it->second.blob.expired())
+                it = blobHashes.erase(it);
+            else
+                ++it;
+        }
+        blobHashesSweepSize = std::max(blobHashesSweepSize, 2 * blobHashes.size());
+    }
+    blobHashes[blob.get()] = {blob, hash};
+
+    return hash;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include <ie_blob.h>
 
 #include <unordered_map>
 #include <functional>
@@ -23,26 +24,20 @@ namespace MKLDNNPlugin {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    SimpleDataHash();
+    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182. Data larger than a block is
+    // summed block by block in parallel and the block sums are summed again, so the result of a given data
+    // doesn't depend on the number of threads
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
 protected:
+    uint64_t update(uint64_t crc, const unsigned char* data, size_t size) const;
+
     static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static const int kSlices = 8;
+    static const size_t kBlockSize = 128 * 1024;
+    // Slicing-by-8 tables, table[0] is the classic byte-at-a-time one
+    uint64_t table[kSlices][kTableSize];
 };
 
 /**
@@ -92,11 +87,25 @@ public:
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Returns the hash of the constant blob data. It is computed once per blob and memoized while the blob
+     * is alive, so graphs of the next streams sharing the blob don't hash the data again.
+     * The blob data must not be changed after the first call
+     */
+    uint64_t hashOf(const InferenceEngine::Blob::CPtr& blob);
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    struct BlobHash {
+        std::weak_ptr<const InferenceEngine::Blob> blob;
+        uint64_t hash;
+    };
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
+    std::unordered_map<const InferenceEngine::Blob*, BlobHash> blobHashes;
+    size_t blobHashesSweepSize = 64;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -3,6 +3,7 @@
 //
 
 #include "base.hpp"
+#include "nms_imp.hpp"
 
 #include <cfloat>
 #include <vector>
@@ -217,16 +218,13 @@ public:
 
                         const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
                         const float *pboxes;
-                        const float *psizes;
                         if (_share_location) {
                             pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
                         } else {
                             pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                         }
 
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                        nms_cf(pconf, pboxes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
                     }
                 });
             } else {
@@ -390,7 +388,7 @@ private:
                       float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
                       bool decodeType = true); // after ARM = false
 
-    void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
+    void nms_cf(const float *conf_data, const float *bboxes,
                 int *buffer, int *indices, int &detections, int num_priors_actual);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
@@ -558,7 +556,6 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
 
 void DetectionOutputImpl::nms_cf(const float* conf_data,
                           const float* bboxes,
-                          const float* sizes,
                           int* buffer,
                           int* indices,
                           int& detections,
@@ -573,26 +570,37 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
 
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    // classes are already processed in parallel, so candidates are sorted and boxes are split across threads
+    // only for a few classes
+    const bool allow_parallel = _num_classes < parallel_get_max_threads();
+    if (allow_parallel) {
+        parallel_sort(indices, indices + count, ConfidenceComparator(conf_data));
+        std::copy(indices, indices + num_output_scores, buffer);
+    } else {
+        std::partial_sort_copy(indices, indices + count,
+                               buffer, buffer + num_output_scores,
+                               ConfidenceComparator(conf_data));
+    }
 
+    // the scratch is sized by the candidates kept after top_k, not by the number of priors
+    std::vector<float> corners(4 * num_output_scores);
+    std::vector<int> is_dead(num_output_scores);
+    float* xmin = corners.data() + 0*num_output_scores;
+    float* ymin = corners.data() + 1*num_output_scores;
+    float* xmax = corners.data() + 2*num_output_scores;
+    float* ymax = corners.data() + 3*num_output_scores;
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
+        xmin[i] = bboxes[idx*4 + 0];
+        ymin[i] = bboxes[idx*4 + 1];
+        xmax[i] = bboxes[idx*4 + 2];
+        ymax[i] = bboxes[idx*4 + 3];
+    }
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
+    const nms_conf conf = {_nms_threshold, 0.0f, false, allow_parallel};
+    detections = XARCH::nms_select(xmin, ymin, xmax, ymax, num_output_scores, is_dead.data(), indices, num_output_scores, conf);
+    for (int k = 0; k < detections; ++k) {
+        indices[k] = buffer[indices[k]];
     }
 }
 
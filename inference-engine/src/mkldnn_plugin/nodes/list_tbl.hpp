@@ -84,3 +84,4 @@ MKLDNN_EXTENSION_NODE(SparseSegmentReduceImpl, SparseSegmentMean);
 MKLDNN_EXTENSION_NODE(SparseSegmentReduceImpl, SparseSegmentSqrtN);
 MKLDNN_EXTENSION_NODE(SparseSegmentReduceImpl, SparseSegmentSum);
 MKLDNN_EXTENSION_NODE(CumSumImpl, CumSum);
+MKLDNN_EXTENSION_NODE(ScaledDotProductAttentionImpl, ScaledDotProductAttention);
@@ -9,9 +9,14 @@
 #include <legacy/ie_layers.h>
 #include <string>
 #include <vector>
+#include <numeric>
+#include <cmath>
+#include <algorithm>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include "ie_parallel.hpp"
 #include "utils/general_utils.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -31,6 +36,19 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLay
     if (getCnnLayer()->type == "FullyConnected" || getCnnLayer()->type == "InnerProduct") {
         baseInputsNumber = getCnnLayer().get()->insData.size();
     }
+
+    // The execution network marks FullyConnected layers of FP32 models if dynamic quantization is enabled
+    auto dynamicQuantizationParam = getCnnLayer()->params.find("dynamic_quantization");
+    auto * fcLayer = dynamic_cast<FullyConnectedLayer*>(getCnnLayer().get());
+    if (dynamicQuantizationParam != getCnnLayer()->params.end() && fcLayer != nullptr && baseInputsNumber == 1 &&
+            fcLayer->_weights != nullptr && fcLayer->_weights->getTensorDesc().getPrecision() == Precision::FP32 &&
+            (fcLayer->_biases == nullptr || fcLayer->_biases->getTensorDesc().getPrecision() == Precision::FP32) &&
+            fcLayer->insData[0].lock()->getPrecision() == Precision::FP32 &&
+            fcLayer->outData[0]->getPrecision() == Precision::FP32 &&
+            impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core)) {
+        dynamicQuantization = dynamicQuantizationParam->second == "per_row" ? DynamicQuantization::PerRow
+                                                                            : DynamicQuantization::PerTensor;
+    }
 }
 
 std::vector<memory::format_tag> MKLDNNFullyConnectedNode::getAvailableFormatsForDims(const MKLDNNDims &dims) const {
@@ -53,6 +71,9 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (!descs.empty())
         return;
 
+    if (!fusedWith.empty())
+        dynamicQuantization = DynamicQuantization::None;
+
     InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
     precision = getCnnLayer()->outData[0]->getPrecision();
@@ -120,6 +141,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         internalBlobs.push_back(createInternalBlob(biasesDims, false));
     }
 
+    // Dynamically quantized FullyConnected is executed without oneDNN primitive, see initSupportedPrimitiveDescriptors()
+    if (isDynamicallyQuantized())
+        return;
+
     for (auto format : getAvailableFormatsForDims(inDims)) {
         MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
         MKLDNNMemoryDesc out_candidate(outDims, outputDataType, memory::format_tag::any);
@@ -128,7 +153,52 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!isDynamicallyQuantized()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto createDataConfig = [](const MKLDNNDims& dims) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, memory::data_type::f32, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    config.inConfs.push_back(createDataConfig(getParentEdgeAt(0)->getDims()));
+    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims()));
+
+    supportedPrimitiveDescriptors.push_back(PrimitiveDescInfo(config, impl_desc_type::gemm_any,
+                                                              MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())));
+}
+
+void MKLDNNFullyConnectedNode::initOptimalPrimitiveDescriptor() {
+    if (!isDynamicallyQuantized()) {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+    if (!isInitConfig(selected_pd->getConfig()))
+        THROW_IE_EXCEPTION << "Dynamically quantized FullyConnected node " << getName() << " supports only planar layouts.";
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (isDynamicallyQuantized()) {
+        if (!quantizedWeights)
+            prepareQuantizedWeights();
+        return;
+    }
+
     if (prim)
         return;
 
@@ -148,8 +218,13 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (isDynamicallyQuantized()) {
+        executeDynamicallyQuantized();
+        return;
+    }
+
     if (prim) {
-        auto reshapeMemory = [this](int argType) {
+        auto reshapeMemory = [this](int argType, const MKLDNNMemory &edgeMemory) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
                 auto oldMem = param->second;
@@ -159,17 +234,165 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
                     mkldnn::memory::desc newMemDesc(oldMem.get_desc().reshape(normalizedDims));
                     mkldnn::memory newMem(newMemDesc, oldMem.get_engine(), oldMem.get_data_handle());
                     primArgs.at(argType) = newMem;
+                } else if (oldMem.get_data_handle() != edgeMemory.GetData()) {
+                    // the reshaped view has to follow the edge memory, which may be redirected to another buffer
+                    // (e.g. by TensorIterator or to the user blob)
+                    param->second.set_data_handle(edgeMemory.GetData());
                 }
             }
         };
 
-        reshapeMemory(DNNL_ARG_SRC);
-        reshapeMemory(DNNL_ARG_DST);
+        reshapeMemory(DNNL_ARG_SRC, getParentEdgeAt(0)->getMemory());
+        reshapeMemory(DNNL_ARG_DST, getChildEdgeAt(0)->getMemory());
 
         (*prim).execute(strm, primArgs);
     }
 }
 
+void MKLDNNFullyConnectedNode::prepareQuantizedWeights() {
+    const size_t OC = weightsDims[0];
+    const size_t IC = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    // Without VNNI pairs of u8 x s8 products are accumulated into saturating int16, so weights are limited to 7 bits
+    const bool withVnni = impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core_vnni);
+    const float maxQuantized = withVnni ? 127.f : 63.f;
+    const size_t weightsSize = rnd_up(OC * IC, 64);
+
+    auto create = [&] () {
+        const auto *weights = internalBlobs[0]->cbuffer().as<const float *>();
+
+        MKLDNNMemoryPtr ptr(new MKLDNNMemory(getEngine()));
+        ptr->Create(MKLDNNDims({static_cast<ptrdiff_t>(weightsSize + OC * (sizeof(float) + sizeof(int32_t)))}),
+                    memory::data_type::u8, memory::format_tag::x);
+
+        auto *data = reinterpret_cast<uint8_t *>(ptr->GetData());
+        auto *quantized = reinterpret_cast<int8_t *>(data);
+        auto *scales = reinterpret_cast<float *>(data + weightsSize);
+        auto *compensation = reinterpret_cast<int32_t *>(scales + OC);
+
+        parallel_for(OC, [&](size_t oc) {
+            const float *w = weights + oc * IC;
+            float absMax = 0.f;
+            for (size_t ic = 0; ic < IC; ic++)
+                absMax = std::max(absMax, std::abs(w[ic]));
+
+            const float scale = absMax > 0.f ? absMax / maxQuantized : 1.f;
+            int32_t sum = 0;
+            for (size_t ic = 0; ic < IC; ic++) {
+                const float q = std::max(-maxQuantized, std::min(maxQuantized, std::nearbyint(w[ic] / scale)));
+                quantized[oc * IC + ic] = static_cast<int8_t>(q);
+                sum += static_cast<int32_t>(q);
+            }
+            scales[oc] = scale;
+            compensation[oc] = sum;
+        });
+
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const auto &weightsBlob = internalBlobs[0];
+        const uint64_t dataHash = getInternalBlobHash(weightsBlob);
+
+        const std::string stringHash = getName() + "_dynamic_quantization_" + std::to_string(withVnni)
+                                       + "_" + std::to_string(weightsBlob->byteSize())
+                                       + "_" + std::to_string(dataHash);
+
+        quantizedWeights = *weightCache->findOrCreate(stringHash, create);
+    } else {
+        quantizedWeights = create();
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeDynamicallyQuantized() {
+    const auto *src = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemory().GetPtr());
+    auto *dst = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemory().GetPtr());
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    // 3D input is processed as a [batch * sequence, IC] matrix
+    const auto &inDims = getParentEdgeAt(0)->getDims();
+    const size_t M = static_cast<size_t>(batchToProcess()) * (inDims.ndims() == 3 ? inDims[1] : 1);
+
+    const auto *weightsData = reinterpret_cast<const uint8_t *>(quantizedWeights->GetData());
+    const auto *weights = reinterpret_cast<const int8_t *>(weightsData);
+    const auto *weightsScales = reinterpret_cast<const float *>(weightsData + rnd_up(OC * IC, 64));
+    const auto *compensation = reinterpret_cast<const int32_t *>(weightsScales + OC);
+    const float *bias = withBiases ? internalBlobs[1]->cbuffer().as<const float *>() : nullptr;
+
+    quantizedSrc.resize(M * IC);
+    accumulator.resize(M * OC);
+    srcScales.resize(M);
+    srcZeroPoints.resize(M);
+
+    // Asymmetric u8 quantization; the range always contains zero, so zeros (e.g. after ReLU) are represented exactly
+    auto setQuantizationParams = [&](size_t m, float minValue, float maxValue) {
+        minValue = std::min(minValue, 0.f);
+        maxValue = std::max(maxValue, 0.f);
+        srcScales[m] = maxValue > minValue ? (maxValue - minValue) / 255.f : 1.f;
+        srcZeroPoints[m] = static_cast<int32_t>(std::nearbyint(-minValue / srcScales[m]));
+    };
+
+    auto quantizeRow = [&](size_t m) {
+        const float *in = src + m * IC;
+        uint8_t *out = quantizedSrc.data() + m * IC;
+        const float invScale = 1.f / srcScales[m];
+        const float zeroPoint = static_cast<float>(srcZeroPoints[m]);
+        for (size_t ic = 0; ic < IC; ic++) {
+            const float q = std::min(std::max(in[ic] * invScale + zeroPoint, 0.f), 255.f);
+            out[ic] = static_cast<uint8_t>(q + 0.5f);
+        }
+    };
+
+    if (dynamicQuantization == DynamicQuantization::PerRow) {
+        // Statistics and quantization of a row are done in one pass while the row is still in cache
+        parallel_for(M, [&](size_t m) {
+            const float *in = src + m * IC;
+            float minValue = in[0], maxValue = in[0];
+            for (size_t ic = 1; ic < IC; ic++) {
+                minValue = std::min(minValue, in[ic]);
+                maxValue = std::max(maxValue, in[ic]);
+            }
+            setQuantizationParams(m, minValue, maxValue);
+            quantizeRow(m);
+        });
+    } else {
+        const int threadsNum = parallel_get_max_threads();
+        std::vector<float> minValues(threadsNum, src[0]), maxValues(threadsNum, src[0]);
+        parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(M * IC, nthr, ithr, start, end);
+            for (size_t i = start; i < end; i++) {
+                minValues[ithr] = std::min(minValues[ithr], src[i]);
+                maxValues[ithr] = std::max(maxValues[ithr], src[i]);
+            }
+        });
+        setQuantizationParams(0, *std::min_element(minValues.begin(), minValues.end()),
+                              *std::max_element(maxValues.begin(), maxValues.end()));
+        std::fill(srcScales.begin() + 1, srcScales.end(), srcScales[0]);
+        std::fill(srcZeroPoints.begin() + 1, srcZeroPoints.end(), srcZeroPoints[0]);
+
+        parallel_for(M, quantizeRow);
+    }
+
+    // Zero points are applied below via the sums of weights, so the whole product is computed by a single u8s8s32 call
+    const int32_t co = 0;
+    mkldnn_gemm_u8s8s32('N', 'T', 'F', M, OC, IC, 1.f, quantizedSrc.data(), IC, 0, weights, IC, 0,
+                        0.f, accumulator.data(), OC, &co);
+
+    parallel_for(M, [&](size_t m) {
+        const int32_t *acc = accumulator.data() + m * OC;
+        float *out = dst + m * OC;
+        const float srcScale = srcScales[m];
+        const int32_t zeroPoint = srcZeroPoints[m];
+        for (size_t oc = 0; oc < OC; oc++)
+            out[oc] = static_cast<float>(acc[oc] - zeroPoint * compensation[oc]) * srcScale * weightsScales[oc];
+        if (bias) {
+            for (size_t oc = 0; oc < OC; oc++)
+                out[oc] += bias[oc];
+        }
+    });
+}
+
 void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false) {
     int blob_idx = 0;
     mkldnn::post_ops ops;
@@ -384,6 +607,9 @@ const mkldnn::memory& MKLDNNFullyConnectedNode::getBias() const {
 }
 
 InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const {
+    if (isDynamicallyQuantized())
+        return Precision::U8;
+
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
     size_t inputsNumLimit = 2;
@@ -19,6 +19,8 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +45,10 @@ public:
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
+    bool isDynamicallyQuantized() const {
+        return dynamicQuantization != DynamicQuantization::None;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -55,6 +61,25 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    // Dynamic quantization: weights are quantized to s8 per output channel once, activations are quantized
+    // to u8 with a scale and a zero point computed on every inference either for the whole tensor or per row
+    enum class DynamicQuantization {
+        None,
+        PerTensor,
+        PerRow
+    };
+    DynamicQuantization dynamicQuantization = DynamicQuantization::None;
+
+    // s8 weights [OC x IC], followed by fp32 dequantization scales [OC] and int32 sums of weights columns [OC]
+    MKLDNNMemoryPtr quantizedWeights;
+    std::vector<uint8_t> quantizedSrc;
+    std::vector<int32_t> accumulator;
+    std::vector<float> srcScales;
+    std::vector<int32_t> srcZeroPoints;
+
+    void prepareQuantizedWeights();
+    void executeDynamicallyQuantized();
 };
 
 }  // namespace MKLDNNPlugin
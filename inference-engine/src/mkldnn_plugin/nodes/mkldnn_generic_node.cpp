@@ -65,6 +65,21 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory || !impls.empty()) {
+        // blobs over the edges memory are created once and reused by every execLayer() call
+        inputBlobs.clear();
+        inputData.clear();
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            auto edge = getParentEdgeAt(i);
+            inputBlobs.push_back(edge->getBlob());
+            inputData.push_back({&edge->getMemory(), edge->getMemory().GetData()});
+        }
+        outputBlobs.clear();
+        outputData.clear();
+        for (size_t i = 0; i < outDims.size(); i++) {
+            auto edge = getChildEdgesAtPort(i)[0];
+            outputBlobs.push_back(edge->getBlob());
+            outputData.push_back({&edge->getMemory(), edge->getMemory().GetData()});
+        }
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -108,50 +123,22 @@ void MKLDNNGenericNode::cleanup() {
 }
 
 void MKLDNNGenericNode::execLayer() {
-    bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
-    std::vector<InferenceEngine::Blob::CPtr> constInputs;
-    std::vector<InferenceEngine::TensorDesc> inputDescs;
-    std::vector<InferenceEngine::SizeVector> outputShapes;
-    for (size_t i = 0; i < getParentEdges().size(); i++) {
-        auto inputBlob = getParentEdgeAt(i)->getBlob();
-        inputs.push_back(inputBlob);
-        constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
-            isDynBatch = false;
-        } else {
-            // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            if (inputDescs[inputDescs.size() - 1].getDims().size() > 0)
-                inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
+    // edges connected to graph inputs and outputs may be redirected to the user memory between inferences
+    auto updateBlobs = [] (std::vector<InferenceEngine::Blob::Ptr>& blobs, std::vector<EdgeData>& edgeData) {
+        for (size_t i = 0; i < blobs.size(); i++) {
+            auto data = edgeData[i].memory->GetData();
+            if (edgeData[i].data != data) {
+                blobs[i] = make_blob_with_precision(blobs[i]->getTensorDesc(), data);
+                edgeData[i].data = data;
+            }
         }
-    }
-
-    if (isDynBatch) {
-        // TODO: use ngraph-based extension mechnism if needed to recompute shape
-        isDynBatch = false;
-    }
+    };
+    updateBlobs(inputBlobs, inputData);
+    updateBlobs(outputBlobs, outputData);
 
-    if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
-            td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
-        }
-    }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
-    for (size_t i = 0; i < outDims.size(); i++) {
-        if (isDynBatch) {
-            auto out_edge = getChildEdgesAtPort(i)[0];
-            auto td = out_edge->getBlob()->getTensorDesc();
-            td.setDims(outputShapes[i]);
-            outputs.push_back(make_blob_with_precision(td, out_edge->getMemory().GetData()));
-        } else {
-            outputs.push_back(getChildEdgesAtPort(i)[0]->getBlob());
-        }
-    }
+    // TODO: use ngraph-based extension mechnism to process dynamic batch
     InferenceEngine::ResponseDesc resp;
-    InferenceEngine::StatusCode rc = impls[0]->execute(inputs, outputs, &resp);
+    InferenceEngine::StatusCode rc = impls[0]->execute(inputBlobs, outputBlobs, &resp);
     if (rc != InferenceEngine::OK) {
         THROW_IE_EXCEPTION << this->getTypeStr() << ":" << this->getName() << ": " << resp.msg;
     }
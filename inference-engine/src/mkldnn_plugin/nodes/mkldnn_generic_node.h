@@ -40,6 +40,15 @@ protected:
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+
+    struct EdgeData {
+        const MKLDNNMemory* memory;
+        void* data;  // the pointer the blob was created with
+    };
+    std::vector<InferenceEngine::Blob::Ptr> inputBlobs;
+    std::vector<InferenceEngine::Blob::Ptr> outputBlobs;
+    std::vector<EdgeData> inputData;
+    std::vector<EdgeData> outputData;
 };
 
 }  // namespace MKLDNNPlugin
@@ -6,6 +6,8 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 #include "common/cpu_memcpy.h"
 
 using namespace mkldnn;
@@ -65,6 +67,10 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     // default memory state is zero filled
     dataStore->FillZero();
+
+    // Without a bound variable state the node works as a single buffer with copies
+    currentState = dataStore;
+    nextState = dataStore;
 }
 
 /**
@@ -94,18 +100,90 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
 }
 
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
+    // The producer has already written the state in place
+    if (new_state.GetData() == nextState->GetData())
+        return;
+
     // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
+    //           nextState.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*nextState, new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     auto dst_mem = getChildEdgeAt(0)->getMemory();
+    if (dst_mem.GetData() == currentState->GetData())
+        return;
+
     // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
+    //           dst_mem.SetData(currentState, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    simple_copy(dst_mem, *currentState);
+}
+
+bool MKLDNNMemoryInputNode::canRebindOutput() const {
+    auto stateDesc = dataStore->GetDescriptor();
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto childEdge = getChildEdgeAt(i);
+        auto& child = childEdge->getChild();
+        // Output memory may be replaced by the user blob
+        if (child->getType() == Output || child->isConstant() || child->isInplace())
+            return false;
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+        // Split is using different ptrs without offsets
+        if (dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            return false;
+        if (childEdge->getMemory().GetDescriptor() != stateDesc)
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetData() == childEdge->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+bool MKLDNNMemoryInputNode::canRebindSibling() const {
+    if (outputNode == nullptr)
+        return false;
+
+    auto parentEdge = outputNode->getParentEdgeAt(0);
+    auto& parent = parentEdge->getParent();
+    // The producer must write into its own memory, which nobody else reads
+    if (parent->getType() == Input || parent->getType() == MemoryInput)
+        return false;
+    if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+        return false;
+    if (parentEdge->getMemory().GetDescriptor() != dataStore->GetDescriptor())
+        return false;
+    for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+        if (parent->getParentEdgeAt(i)->getMemory().GetData() == parentEdge->getMemory().GetData())
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNMemoryInputNode::bindState(const MKLDNNMemoryPtr& current, const MKLDNNMemoryPtr& next) {
+    IE_ASSERT(current->GetData() != next->GetData()) << "Current and next values of the state " << getId() << " share memory";
+
+    if (!rebindChecked) {
+        outputRebindable = canRebindOutput();
+        siblingRebindable = canRebindSibling();
+        rebindChecked = true;
+    }
+
+    currentState = current;
+    nextState = next;
+
+    if (outputRebindable) {
+        for (size_t i = 0; i < getChildEdges().size(); i++)
+            getChildEdgeAt(i)->getMemory().GetPrimitivePtr()->set_data_handle(current->GetData());
+    }
+    if (siblingRebindable) {
+        outputNode->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->set_data_handle(next->GetData());
+    }
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
@@ -117,6 +195,7 @@ MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(
         auto outputNode = dynamic_cast<MKLDNNMemoryOutputNode*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -132,6 +211,7 @@ MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerOutput
         auto inputNode = dynamic_cast<MKLDNNMemoryInputNode*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
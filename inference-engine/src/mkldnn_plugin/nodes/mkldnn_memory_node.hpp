@@ -96,11 +96,36 @@ public:
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
+    void setOutputNode(MKLDNNMemoryOutputNode* node) {
+        outputNode = node;
+    }
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Makes the graph work directly on the buffers of a variable state: consumers of this node read
+     * the current value and the producer of the paired MemoryOutput writes the next one.
+     * Sides of the pair which can't be rebound fall back to copies on execution.
+     * @param current Memory with the value of the state
+     * @param next Memory receiving the new value of the state, must not be the same as current
+     */
+    void bindState(const MKLDNNMemoryPtr& current, const MKLDNNMemoryPtr& next);
+
  private:
+    bool canRebindOutput() const;
+    bool canRebindSibling() const;
+
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr currentState;
+    MKLDNNMemoryPtr nextState;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
+    /**
+     * @brief keeps reference to output sibling node
+     */
+    MKLDNNMemoryOutputNode* outputNode = nullptr;
+    bool rebindChecked = false;
+    bool outputRebindable = false;
+    bool siblingRebindable = false;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,231 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <legacy/ie_layers.h>
+#include <ie_parallel.hpp>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/graph_util.hpp>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+
+#include "emitters/cpu_generator.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(layer, eng, cache) {
+    auto tmp_snippet = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(layer->getNode());
+    if (!tmp_snippet)
+        THROW_IE_EXCEPTION << "Cannot get snippet operation for layer " << layer->name;
+
+    // code generation transforms the body, so the node gets its own copy of the subgraph
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto& input : tmp_snippet->input_values()) {
+        subgraph_node_inputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape()));
+    }
+    auto new_body = ngraph::clone_function(*tmp_snippet->get_body());
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    snippet->set_friendly_name(tmp_snippet->get_friendly_name());
+}
+
+void MKLDNNSnippetNode::getSupportedDescriptors() {
+    if (getParentEdges().size() != snippet->get_input_size())
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty() || outDims.size() != snippet->get_output_size())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    if (!mayiuse(x64::avx2))
+        THROW_IE_EXCEPTION << "Layer " << getName() << " requires at least AVX2 instruction set";
+
+    auto createDataConfig = [](const MKLDNNDims& dims) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, memory::data_type::f32, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        config.inConfs.push_back(createDataConfig(getParentEdgeAt(i)->getDims()));
+    for (size_t i = 0; i < outDims.size(); i++)
+        config.outConfs.push_back(createDataConfig(outDims[i]));
+
+    impl_desc_type impl_type = mayiuse(x64::avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    supportedPrimitiveDescriptors.push_back({config, impl_type});
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate for layer " << getName();
+    }
+    for (size_t i = 0; i < outDims.size(); i++) {
+        auto& dstMemPtr = getChildEdgesAtPort(i)[0]->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Destination memory didn't allocate for layer " << getName();
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set for layer " << getName();
+
+    prepareSchedule();
+}
+
+void MKLDNNSnippetNode::prepareSchedule() {
+    const auto isa = mayiuse(x64::avx512_common) ? x64::avx512_common : x64::avx2;
+    snippet->set_generator(std::make_shared<CPUGenerator>(isa));
+
+    auto toBlockedShape = [](const SizeVector& dims) {
+        ngraph::AxisVector order(dims.size());
+        std::iota(order.begin(), order.end(), 0);
+        return ngraph::snippets::op::Subgraph::BlockedShape(ngraph::Shape(dims), order, ngraph::element::f32);
+    };
+
+    std::vector<SizeVector> dims;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector input_shapes, output_shapes;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        dims.push_back(getParentEdgeAt(i)->getDims().ToSizeVector());
+        input_shapes.push_back(toBlockedShape(dims.back()));
+    }
+    for (size_t i = 0; i < outDims.size(); i++) {
+        dims.push_back(outDims[i].ToSizeVector());
+        output_shapes.push_back(toBlockedShape(dims.back()));
+    }
+
+    schedule = snippet->generate(output_shapes, input_shapes);
+
+    // all outputs have the same rank, the work covers the broadcasted shape of them
+    work_dims = outDims[0].ToSizeVector();
+    for (size_t i = 1; i < outDims.size(); i++) {
+        const auto out = outDims[i].ToSizeVector();
+        if (out.size() != work_dims.size())
+            THROW_IE_EXCEPTION << "Layer " << getName() << " has outputs of different ranks";
+        for (size_t j = 0; j < work_dims.size(); j++)
+            work_dims[j] = std::max(work_dims[j], out[j]);
+    }
+    if (work_dims.empty())
+        work_dims.push_back(1);
+
+    // broadcasted outputs are stored several times, so rows can't be distributed between threads
+    run_in_parallel = std::all_of(outDims.begin(), outDims.end(), [&](const MKLDNNDims& out) {
+        return out.ToSizeVector() == work_dims || (out.ndims() == 0 && work_dims == SizeVector{1});
+    });
+
+    for (auto& d : dims) {
+        if (d.size() > work_dims.size())
+            THROW_IE_EXCEPTION << "Layer " << getName() << " has an input of higher rank than outputs";
+        d.insert(d.begin(), work_dims.size() - d.size(), 1);
+    }
+
+    // collapse outer dimensions into the innermost one while every tensor is either dense or broadcasted over both,
+    // so the kernel generated for the original shapes still handles the innermost dimension in the same way
+    while (work_dims.size() > 1 && work_dims.back() > 1) {
+        const size_t k = work_dims.size() - 2;
+        const bool can_collapse = std::all_of(dims.begin(), dims.end(), [&](const SizeVector& d) {
+            return (d[k] == work_dims[k] && d.back() == work_dims.back()) || (d[k] == 1 && d.back() == 1);
+        });
+        if (!can_collapse)
+            break;
+
+        work_dims[k] *= work_dims.back();
+        work_dims.pop_back();
+        for (auto& d : dims) {
+            d[k] *= d.back();
+            d.pop_back();
+        }
+    }
+
+    const size_t outer_rank = work_dims.size() - 1;
+    data_strides.assign(dims.size(), SizeVector(outer_rank, 0));
+    is_innermost_broadcasted.assign(dims.size(), false);
+    for (size_t i = 0; i < dims.size(); i++) {
+        size_t stride = dims[i].back();
+        for (size_t j = outer_rank; j-- > 0;) {
+            data_strides[i][j] = dims[i][j] == 1 ? 0 : stride;
+            stride *= dims[i][j];
+        }
+        is_innermost_broadcasted[i] = dims[i].back() == 1 && work_dims.back() != 1;
+    }
+
+    rows = std::accumulate(work_dims.begin(), work_dims.end() - 1, static_cast<size_t>(1), std::multiplies<size_t>());
+
+    // few long rows are split into chunks to keep all threads busy, chunks are aligned to the widest vector
+    const size_t inner = work_dims.back();
+    const size_t min_chunk = 256;
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    row_chunks = 1;
+    if (run_in_parallel && rows < nthr)
+        row_chunks = std::min(div_up(nthr, rows), div_up(inner, min_chunk));
+    row_chunk = rnd_up(div_up(inner, row_chunks), 16);
+    row_chunks = div_up(inner, row_chunk);
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    std::vector<const uint8_t*> data_ptrs;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        data_ptrs.push_back(reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr()));
+    for (size_t i = 0; i < outDims.size(); i++)
+        data_ptrs.push_back(reinterpret_cast<const uint8_t*>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr()));
+
+    const auto ker = reinterpret_cast<kernel>(const_cast<uint8_t*>(schedule.ptr));
+    const size_t inner = work_dims.back();
+    const size_t outer_rank = work_dims.size() - 1;
+
+    auto process = [&](size_t start, size_t end) {
+        // snippets have at most 7 inputs and outputs
+        const void* args[8];
+        for (size_t w = start; w < end; w++) {
+            const size_t row = w / row_chunks;
+            const size_t begin = (w % row_chunks) * row_chunk;
+            for (size_t i = 0; i < data_ptrs.size(); i++) {
+                size_t offset = is_innermost_broadcasted[i] ? 0 : begin;
+                size_t rest = row;
+                for (size_t j = outer_rank; j-- > 0;) {
+                    offset += (rest % work_dims[j]) * data_strides[i][j];
+                    rest /= work_dims[j];
+                }
+                args[i] = data_ptrs[i] + offset * sizeof(float);
+            }
+            ker(args, static_cast<int64_t>(std::min(row_chunk, inner - begin)));
+        }
+    };
+
+    const size_t work_amount = rows * row_chunks;
+    if (run_in_parallel) {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work_amount, nthr, ithr, start, end);
+            process(start, end);
+        });
+    } else {
+        process(0, work_amount);
+    }
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
@@ -0,0 +1,52 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "snippets/op/subgraph.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Executes a subgraph of elementwise operations collapsed by snippets tokenization
+ * as a single kernel generated by CPUGenerator.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNSnippetNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    using kernel = void (*)(const void* args[], int64_t work_amount);
+
+    void prepareSchedule();
+
+    // body of the subgraph owned by this node, code generation modifies it
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    ngraph::snippets::Schedule schedule;
+
+    // dimensions of the work after collapsing, the innermost one is processed by a single kernel call
+    std::vector<size_t> work_dims;
+    // strides in elements for each input and output over the outer dimensions of the work, 0 for broadcasted ones
+    std::vector<std::vector<size_t>> data_strides;
+    std::vector<bool> is_innermost_broadcasted;
+    size_t rows = 1;
+    size_t row_chunk = 0;
+    size_t row_chunks = 1;
+    bool run_in_parallel = true;
+};
+
+}  // namespace MKLDNNPlugin
@@ -9,8 +9,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -47,10 +50,57 @@ static InferenceEngine::LayerConfig make_plain_config(const InferenceEngine::CNN
     return config;
 }
 
+/**
+ * Returns memory objects of all edges of the body input, if the input data may be redirected to another buffer
+ * without copying. It's not possible if some consumer works in-place with the input or uses views on it.
+ */
+static std::vector<MKLDNNMemoryPtr> getRebindableInputMemory(const MKLDNNNodePtr &input) {
+    std::vector<MKLDNNMemoryPtr> memory;
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto edge = input->getChildEdgeAt(i);
+        auto child = edge->getChild();
+        if (child->getType() == Output || child->isConstant() || child->isInplace())
+            return {};
+
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return {};
+        // split is using different ptrs without offsets
+        if (dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            return {};
+
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetData() == edge->getMemory().GetData())
+                return {};
+        }
+        memory.push_back(edge->getMemoryPtr());
+    }
+    return memory;
+}
+
+/**
+ * Returns memory of the body output, if the producer may write the output to another buffer.
+ * The producer must own the memory exclusively: no in-place, no other consumers of the port.
+ */
+static MKLDNNMemoryPtr getRebindableOutputMemory(const MKLDNNNodePtr &output) {
+    auto edge = output->getParentEdgeAt(0);
+    auto parent = edge->getParent();
+    if (parent->getType() == Input || parent->isConstant() || parent->isInplace() ||
+            parent->getChildEdgesAtPort(edge->getInputNum()).size() != 1)
+        return nullptr;
+
+    return edge->getMemoryPtr();
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
+    /**
+     * body_mem are memory objects which may be bound directly to the slices of the outer tensor,
+     * empty if the body memory may not be redirected
+     */
     PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
-                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng)
+                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng,
+                       const std::vector<MKLDNNMemoryPtr> &body_mem = {})
                        : sliced_src(sliced_src) {
         const auto &full_blob = sliced_src ? from : to;
         const auto &part_blob = !sliced_src ? from : to;
@@ -84,6 +134,24 @@ public:
         chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
         chunk_stride_in_byte *= sign_of_stride;
 
+        // Every chunk is a dense block of the full tensor if all outer dimensions are 1,
+        // so the body may work with it directly if it uses the same plain layout
+        bool dense_chunk = true;
+        for (int i = 0; i < axis; i++)
+            dense_chunk = dense_chunk && full_dims[i] == 1;
+
+        zero_copy = !body_mem.empty() && dense_chunk &&
+                    full_blob->GetDataType() == part_blob->GetDataType() &&
+                    full_blob->GetDesc().isPlainFormat() && part_blob->GetDesc().isPlainFormat();
+
+        if (zero_copy) {
+            for (const auto &mem : body_mem) {
+                bound_mem.push_back(mem);
+                bound_mem_handles.push_back(mem->GetData());
+            }
+            return;
+        }
+
         if (sliced_src) {
             mem_holder_src = chunk_mem;
             mem_holder_dst = to->GetPrimitive();
@@ -97,13 +165,33 @@ public:
     void execute(mkldnn::stream strm, int iter) override {
         IE_ASSERT(iter >= 0 && iter < iter_count);
 
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+
+        if (zero_copy) {
+            for (auto &mem : bound_mem)
+                mem->GetPrimitivePtr()->set_data_handle(chunk_ptr);
+            return;
+        }
+
         auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        chunk_mem.set_data_handle(chunk_ptr);
 
         reorder.execute(strm, mem_holder_src, mem_holder_dst);
     }
 
+    void restore() override {
+        for (size_t i = 0; i < bound_mem.size(); i++)
+            bound_mem[i]->GetPrimitivePtr()->set_data_handle(bound_mem_handles[i]);
+    }
+
+    /**
+     * In zero copy mode sliced outputs have to be bound before the iteration is executed
+     */
+    bool isZeroCopy() const {
+        return zero_copy;
+    }
+
 private:
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
@@ -112,6 +200,10 @@ private:
     mkldnn::memory full_mem;
 
     int iter_count;
+
+    bool zero_copy = false;
+    std::vector<MKLDNNMemoryPtr> bound_mem;
+    std::vector<void*> bound_mem_handles;
 };
 
 class BackEdgePortHelper : public PortMapHelper {
@@ -129,6 +221,45 @@ public:
     }
 };
 
+/**
+ * Passes data of the back edge without copying: the body input is redirected to the buffer the output
+ * was written to on the previous iteration. If the output isn't bound to the outer tensor, it takes
+ * the former input buffer, so two buffers are swapped between iterations.
+ */
+class BackEdgeRebindHelper : public PortMapHelper {
+public:
+    BackEdgeRebindHelper(const MKLDNNMemoryPtr &from, const std::vector<MKLDNNMemoryPtr> &to, bool swap)
+            : from(from), to(to), swap(swap) {
+        from_handle = from->GetData();
+        to_handle = to[0]->GetData();
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter == 0)
+            return;
+
+        auto produced = from->GetData();
+        auto consumed = to[0]->GetData();
+        for (auto &mem : to)
+            mem->GetPrimitivePtr()->set_data_handle(produced);
+        if (swap)
+            from->GetPrimitivePtr()->set_data_handle(consumed);
+    }
+
+    void restore() override {
+        for (auto &mem : to)
+            mem->GetPrimitivePtr()->set_data_handle(to_handle);
+        from->GetPrimitivePtr()->set_data_handle(from_handle);
+    }
+
+private:
+    MKLDNNMemoryPtr from;
+    std::vector<MKLDNNMemoryPtr> to;
+    bool swap;
+    void *from_handle;
+    void *to_handle;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -205,6 +336,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto &in_node = in_map.at(in_data->getName());
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
         input_mem.push_back(in_mem);
+        input_nodes.push_back(in_node);
     }
 
     // Assume that order of outputs in original TI and produces sub_graph is same
@@ -212,6 +344,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
     for (size_t i = 0; i < out_vec.size(); i++) {
         auto out_mem = out_vec[i]->getParentEdgeAt(0)->getMemoryPtr();
         output_mem.push_back(out_mem);
+        output_nodes.push_back(out_vec[i]);
     }
 }
 
@@ -231,6 +364,16 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
     const auto &eng = getEngine();
 
+    // Body memory is redirected to other buffers instead of copying data where it's safe.
+    // A body port may be redirected only by a single rule, otherwise rules would conflict.
+    std::map<int, int> sliced_out_uses, back_edge_out_uses, back_edge_in_uses;
+    for (const auto &map_rule : ti->output_port_map)
+        if (map_rule.axis != -1) sliced_out_uses[map_rule.to]++;
+    for (const auto &map_rule : ti->back_edges) {
+        back_edge_out_uses[map_rule.from]++;
+        back_edge_in_uses[map_rule.to]++;
+    }
+
     for (auto map_rule : ti->input_port_map) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
@@ -238,26 +381,59 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         if (map_rule.axis == -1)
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
         else
-            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng,
+                                                               getRebindableInputMemory(input_nodes[map_rule.to])));
     }
 
+    // Bound outputs have to be redirected to the next chunk before the iteration, but after the back edges
+    // have taken the result of the previous iteration
+    std::vector<std::shared_ptr<PortMapHelper>> bound_out_mappers;
+    std::set<int> bound_outputs;
     for (auto map_rule : ti->output_port_map) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
+            continue;
+        }
+
+        std::vector<MKLDNNMemoryPtr> body_mem;
+        auto rebindable_mem = getRebindableOutputMemory(output_nodes[map_rule.to]);
+        if (rebindable_mem && sliced_out_uses[map_rule.to] == 1)
+            body_mem.push_back(rebindable_mem);
+
+        auto mapper = std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng, body_mem);
+        if (mapper->isZeroCopy()) {
+            bound_out_mappers.push_back(mapper);
+            bound_outputs.insert(map_rule.to);
+        } else {
+            after_mappers.push_back(mapper);
+        }
     }
 
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        std::vector<MKLDNNMemoryPtr> rebindable_in;
+        MKLDNNMemoryPtr rebindable_out;
+        if (back_edge_out_uses[map_rule.from] == 1 && back_edge_in_uses[map_rule.to] == 1 &&
+                from_mem->GetDescriptor() == to_mem->GetDescriptor()) {
+            rebindable_in = getRebindableInputMemory(input_nodes[map_rule.to]);
+            rebindable_out = getRebindableOutputMemory(output_nodes[map_rule.from]);
+        }
+
+        if (!rebindable_in.empty() && rebindable_out) {
+            bool swap = bound_outputs.count(map_rule.from) == 0;
+            before_mappers.emplace_back(new BackEdgeRebindHelper(rebindable_out, rebindable_in, swap));
+        } else {
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        }
     }
 
+    before_mappers.insert(before_mappers.end(), bound_out_mappers.begin(), bound_out_mappers.end());
+
     // special purpose ports
     constexpr auto key_cur_iter_port = "loop_body_current_iteration_idx";
     constexpr auto key_cond_port = "loop_body_condition_output_idx";
@@ -322,6 +498,9 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
 
     for (auto &mapper : last_mappers)
         mapper->execute(strm);
+
+    for (auto &mapper : before_mappers)
+        mapper->restore();
 }
 
 bool MKLDNNTensorIteratorNode::created() const {
@@ -17,11 +17,14 @@ namespace MKLDNNPlugin {
  * Functor interface to perform some action with pointed tensors (captured in constructor)
  * Generally it's read, write or move data from specified tensors.
  * Action may depends on iteration index.
+ * Instead of moving data some helpers redirect body memory to other buffers, restore() returns
+ * the body memory to its own buffers once the loop is finished.
  */
 class PortMapHelper {
 public:
     virtual ~PortMapHelper() = default;
     virtual void execute(mkldnn::stream strm, int n_iter = -1) = 0;
+    virtual void restore() {}
 protected:
     mkldnn::reorder reorder;
     mkldnn::memory mem_holder_src;
@@ -62,6 +65,7 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -0,0 +1,183 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_imp.hpp"
+
+#include <cstring>
+#include <algorithm>
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// boxes behind the current one are split into chunks across threads only for really long lists,
+// otherwise the threading overhead of every selected box outweighs the vectorized IoU computation
+static const int parallel_tail_size = 8192;
+static const int parallel_chunk_size = 2048;
+
+static inline float intersection_over_union(float x0i, float y0i, float x1i, float y1i, float area_i,
+                                           float x0j, float y0j, float x1j, float y1j, float coordinates_offset) {
+    const float area_j = (x1j - x0j + coordinates_offset) * (y1j - y0j + coordinates_offset);
+    if (area_i <= 0.0f || area_j <= 0.0f)
+        return 0.0f;
+    if (!(x0i <= x1j && y0i <= y1j && x0j <= x1i && y0j <= y1i))
+        return 0.0f;
+
+    const float width  = (std::max)(0.0f, (std::min)(x1i, x1j) - (std::max)(x0i, x0j) + coordinates_offset);
+    const float height = (std::max)(0.0f, (std::min)(y1i, y1j) - (std::max)(y0i, y0j) + coordinates_offset);
+    const float area = width * height;
+
+    return area / (area_i + area_j - area);
+}
+
+// marks boxes from [begin, end) which overlap the box too much
+static void suppress(const float* x0, const float* y0, const float* x1, const float* y1, const int box,
+                     const int begin, const int end, int* is_dead, const nms_conf& conf) {
+    const float x0i = x0[box];
+    const float y0i = y0[box];
+    const float x1i = x1[box];
+    const float y1i = y1[box];
+    const float area_i = (x1i - x0i + conf.coordinates_offset) * (y1i - y0i + conf.coordinates_offset);
+
+    int tail = begin;
+
+#if defined(HAVE_AVX512F)
+    {
+        const __m512  vc_offset = _mm512_set1_ps(conf.coordinates_offset);
+        const __m512  vc_zero   = _mm512_setzero_ps();
+        const __m512  vc_thresh = _mm512_set1_ps(conf.iou_threshold_);
+        const __m512i vc_ione   = _mm512_set1_epi32(1);
+
+        const __m512 vx0i = _mm512_set1_ps(x0i);
+        const __m512 vy0i = _mm512_set1_ps(y0i);
+        const __m512 vx1i = _mm512_set1_ps(x1i);
+        const __m512 vy1i = _mm512_set1_ps(y1i);
+        const __m512 vA_area = _mm512_set1_ps(area_i);
+
+        for (; tail <= end - 16; tail += 16) {
+            const __m512 vx0j = _mm512_loadu_ps(x0 + tail);
+            const __m512 vy0j = _mm512_loadu_ps(y0 + tail);
+            const __m512 vx1j = _mm512_loadu_ps(x1 + tail);
+            const __m512 vy1j = _mm512_loadu_ps(y1 + tail);
+
+            const __m512 vB_area = _mm512_mul_ps(_mm512_add_ps(_mm512_sub_ps(vx1j, vx0j), vc_offset),
+                                                 _mm512_add_ps(_mm512_sub_ps(vy1j, vy0j), vc_offset));
+
+            const __m512 vwidth  = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(vx1i, vx1j), _mm512_max_ps(vx0i, vx0j)), vc_offset);
+            const __m512 vheight = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(vy1i, vy1j), _mm512_max_ps(vy0i, vy0j)), vc_offset);
+            const __m512 varea = _mm512_mul_ps(_mm512_max_ps(vc_zero, vwidth), _mm512_max_ps(vc_zero, vheight));
+            __m512 viou = _mm512_div_ps(varea, _mm512_sub_ps(_mm512_add_ps(vA_area, vB_area), varea));
+
+            // IoU of empty or not overlapped boxes is zero
+            __mmask16 vvalid = _mm512_cmp_ps_mask(vB_area, vc_zero, _CMP_GT_OS);
+            vvalid = _mm512_mask_cmp_ps_mask(vvalid, vA_area, vc_zero, _CMP_GT_OS);
+            vvalid = _mm512_mask_cmp_ps_mask(vvalid, vx0i, vx1j, _CMP_LE_OS);
+            vvalid = _mm512_mask_cmp_ps_mask(vvalid, vy0i, vy1j, _CMP_LE_OS);
+            vvalid = _mm512_mask_cmp_ps_mask(vvalid, vx0j, vx1i, _CMP_LE_OS);
+            vvalid = _mm512_mask_cmp_ps_mask(vvalid, vy0j, vy1i, _CMP_LE_OS);
+            viou = _mm512_maskz_mov_ps(vvalid, viou);
+
+            const __mmask16 vmask = conf.suppress_equal ? _mm512_cmp_ps_mask(viou, vc_thresh, _CMP_GE_OS)
+                                                        : _mm512_cmp_ps_mask(viou, vc_thresh, _CMP_GT_OS);
+
+            _mm512_mask_storeu_epi32(is_dead + tail, vmask, vc_ione);
+        }
+    }
+#endif
+
+#if defined(HAVE_AVX2)
+    {
+        const __m256  vc_offset = _mm256_set1_ps(conf.coordinates_offset);
+        const __m256  vc_zero   = _mm256_setzero_ps();
+        const __m256  vc_thresh = _mm256_set1_ps(conf.iou_threshold_);
+        const __m256i vc_ione   = _mm256_set1_epi32(1);
+
+        const __m256 vx0i = _mm256_set1_ps(x0i);
+        const __m256 vy0i = _mm256_set1_ps(y0i);
+        const __m256 vx1i = _mm256_set1_ps(x1i);
+        const __m256 vy1i = _mm256_set1_ps(y1i);
+        const __m256 vA_area = _mm256_set1_ps(area_i);
+
+        for (; tail <= end - 8; tail += 8) {
+            const __m256 vx0j = _mm256_loadu_ps(x0 + tail);
+            const __m256 vy0j = _mm256_loadu_ps(y0 + tail);
+            const __m256 vx1j = _mm256_loadu_ps(x1 + tail);
+            const __m256 vy1j = _mm256_loadu_ps(y1 + tail);
+
+            const __m256 vB_area = _mm256_mul_ps(_mm256_add_ps(_mm256_sub_ps(vx1j, vx0j), vc_offset),
+                                                 _mm256_add_ps(_mm256_sub_ps(vy1j, vy0j), vc_offset));
+
+            const __m256 vwidth  = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(vx1i, vx1j), _mm256_max_ps(vx0i, vx0j)), vc_offset);
+            const __m256 vheight = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(vy1i, vy1j), _mm256_max_ps(vy0i, vy0j)), vc_offset);
+            const __m256 varea = _mm256_mul_ps(_mm256_max_ps(vc_zero, vwidth), _mm256_max_ps(vc_zero, vheight));
+            __m256 viou = _mm256_div_ps(varea, _mm256_sub_ps(_mm256_add_ps(vA_area, vB_area), varea));
+
+            // IoU of empty or not overlapped boxes is zero
+            __m256 vvalid = _mm256_cmp_ps(vB_area, vc_zero, _CMP_GT_OS);
+            vvalid = _mm256_and_ps(vvalid, _mm256_cmp_ps(vA_area, vc_zero, _CMP_GT_OS));
+            vvalid = _mm256_and_ps(vvalid, _mm256_cmp_ps(vx0i, vx1j, _CMP_LE_OS));
+            vvalid = _mm256_and_ps(vvalid, _mm256_cmp_ps(vy0i, vy1j, _CMP_LE_OS));
+            vvalid = _mm256_and_ps(vvalid, _mm256_cmp_ps(vx0j, vx1i, _CMP_LE_OS));
+            vvalid = _mm256_and_ps(vvalid, _mm256_cmp_ps(vy0j, vy1i, _CMP_LE_OS));
+            viou = _mm256_and_ps(viou, vvalid);
+
+            const __m256 vmask = conf.suppress_equal ? _mm256_cmp_ps(viou, vc_thresh, _CMP_GE_OS)
+                                                     : _mm256_cmp_ps(viou, vc_thresh, _CMP_GT_OS);
+
+            _mm256_maskstore_epi32(is_dead + tail, _mm256_castps_si256(vmask), vc_ione);
+        }
+    }
+#endif
+
+    for (; tail < end; ++tail) {
+        const float iou = intersection_over_union(x0i, y0i, x1i, y1i, area_i,
+                                                  x0[tail], y0[tail], x1[tail], y1[tail], conf.coordinates_offset);
+        if (conf.suppress_equal ? iou >= conf.iou_threshold_ : iou > conf.iou_threshold_)
+            is_dead[tail] = 1;
+    }
+}
+
+int nms_select(const float* x0, const float* y0, const float* x1, const float* y1, const int num_boxes,
+               int* is_dead, int* kept, const int max_num_out, const nms_conf& conf) {
+    int count = 0;
+    if (num_boxes <= 0 || max_num_out <= 0)
+        return count;
+
+    std::memset(is_dead, 0, num_boxes * sizeof(int));
+
+    const bool parallel = conf.allow_parallel && parallel_get_max_threads() > 1;
+    for (int box = 0; box < num_boxes; ++box) {
+        if (is_dead[box])
+            continue;
+
+        kept[count++] = box;
+        if (count == max_num_out)
+            break;
+
+        const int tail = box + 1;
+        const int tail_size = num_boxes - tail;
+        if (parallel && tail_size >= parallel_tail_size) {
+            const int num_chunks = (tail_size + parallel_chunk_size - 1) / parallel_chunk_size;
+            parallel_for(num_chunks, [&](int chunk) {
+                const int begin = tail + chunk * parallel_chunk_size;
+                const int end = (std::min)(begin + parallel_chunk_size, num_boxes);
+                suppress(x0, y0, x1, y1, box, begin, end, is_dead, conf);
+            });
+        } else {
+            suppress(x0, y0, x1, y1, box, tail, num_boxes, is_dead, conf);
+        }
+    }
+
+    return count;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct nms_conf {
+    float iou_threshold_;
+    float coordinates_offset;  // added to the box width and height, 1 for pixel coordinates of legacy frameworks
+    bool suppress_equal;       // suppress boxes which IoU is equal to the threshold
+    bool allow_parallel;       // split suppression of large box lists across threads
+};
+
+namespace XARCH {
+
+/**
+ * Greedy hard NMS over boxes sorted by descending score.
+ * Boxes are passed as separate arrays of (x0, y0, x1, y1) corner coordinates with x0 <= x1 and y0 <= y1,
+ * IoU of boxes with non positive area or without overlap is zero.
+ * is_dead is a scratch buffer of num_boxes elements, kept receives positions of selected boxes in the input order.
+ * Returns the number of selected boxes, it is not greater than max_num_out.
+ */
+int nms_select(const float* x0, const float* y0, const float* x1, const float* y1, const int num_boxes,
+               int* is_dead, int* kept, const int max_num_out, const nms_conf& conf);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
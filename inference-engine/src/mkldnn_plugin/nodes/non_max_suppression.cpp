@@ -3,6 +3,7 @@
 //
 
 #include "base.hpp"
+#include "nms_imp.hpp"
 
 #include <cmath>
 #include <string>
@@ -143,29 +144,26 @@ public:
         }
     }
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+    void getCorners(const float *box, float &xmin, float &ymin, float &xmax, float &ymax) {
         if (boxEncodingType == boxEncoding::CENTER) {
             //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
+            ymin = box[1] - box[3] / 2.f;
+            xmin = box[0] - box[2] / 2.f;
+            ymax = box[1] + box[3] / 2.f;
+            xmax = box[0] + box[2] / 2.f;
         } else {
             //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+            ymin = (std::min)(box[0], box[2]);
+            xmin = (std::min)(box[1], box[3]);
+            ymax = (std::max)(box[0], box[2]);
+            xmax = (std::max)(box[1], box[3]);
         }
+    }
+
+    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
+        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+        getCorners(boxesI, xminI, yminI, xmaxI, ymaxI);
+        getCorners(boxesJ, xminJ, yminJ, xmaxJ, ymaxJ);
 
         float areaI = (ymaxI - yminI) * (xmaxI - xminI);
         float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
@@ -258,6 +256,9 @@ public:
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
                              std::vector<filteredBoxes> &filtBoxes) {
         int max_out_box = static_cast<int>(max_output_boxes_per_class);
+        // boxes of the same class are suppressed in parallel only if there are not enough classes to occupy all threads
+        const bool boxParallel = num_batches * num_classes < static_cast<size_t>(parallel_get_max_threads());
+        const nms_conf conf = {iou_threshold, 0.0f, true, boxParallel};
         parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
             const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
@@ -274,23 +275,25 @@ public:
                               [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                                 });
-                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
 
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+                // corners of sorted boxes are stored coordinate by coordinate for the vectorized IoU computation
+                const int sorted_size = static_cast<int>(sorted_boxes.size());
+                std::vector<float> corners(4 * sorted_size);
+                float *xmin = &corners[0 * sorted_size];
+                float *ymin = &corners[1 * sorted_size];
+                float *xmax = &corners[2 * sorted_size];
+                float *ymax = &corners[3 * sorted_size];
+                for (int i = 0; i < sorted_size; i++)
+                    getCorners(&boxesPtr[sorted_boxes[i].second * 4], xmin[i], ymin[i], xmax[i], ymax[i]);
+
+                std::vector<int> is_dead(sorted_size);
+                std::vector<int> kept((std::min)(sorted_size, max_out_box));
+                io_selection_size = XARCH::nms_select(xmin, ymin, xmax, ymax, sorted_size, &is_dead[0], &kept[0], max_out_box, conf);
+
+                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+                for (int i = 0; i < io_selection_size; i++) {
+                    const auto &box = sorted_boxes[kept[i]];
+                    filtBoxes[offset + i] = filteredBoxes(box.first, batch_idx, class_idx, box.second);
                 }
             }
             numFiltBox[batch_idx][class_idx] = io_selection_size;
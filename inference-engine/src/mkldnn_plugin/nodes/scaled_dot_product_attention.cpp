@@ -0,0 +1,312 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base.hpp"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * Computes softmax(scale * Q x K^T + mask) x V without materializing the [L_q x L_k] scores matrix.
+ * Every thread processes a block of query rows against consecutive blocks of key/value rows and keeps
+ * the running maximum and sum of the softmax (online softmax), so only small tiles stay in cache.
+ * Both products of a tile are computed by 4 x 16 register blocks written as plain loops the compiler vectorizes.
+ */
+class ScaledDotProductAttentionImpl: public ExtLayerBase {
+public:
+    explicit ScaledDotProductAttentionImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.size() != 3 && layer->insData.size() != 4)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect number of input edges!";
+            if (layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect number of output edges!";
+
+            scale = layer->GetParamAsFloat("scale", 1.f);
+            transpose_key = layer->GetParamAsBool("transpose_key", true);
+
+            const SizeVector& query_dims = layer->insData[QUERY].lock()->getTensorDesc().getDims();
+            const SizeVector& key_dims = layer->insData[KEY].lock()->getTensorDesc().getDims();
+            const SizeVector& value_dims = layer->insData[VALUE].lock()->getTensorDesc().getDims();
+            const size_t rank = query_dims.size();
+            if (rank < 2 || key_dims.size() != rank || value_dims.size() != rank)
+                THROW_IE_EXCEPTION << layer->name << " Query, key and value must have the same rank not less than 2!";
+
+            for (size_t i = 0; i < rank - 2; i++) {
+                if (key_dims[i] != query_dims[i] || value_dims[i] != query_dims[i])
+                    THROW_IE_EXCEPTION << layer->name << " Query, key and value have different batch dimensions!";
+                batch *= query_dims[i];
+            }
+            q_len = query_dims[rank - 2];
+            head_size = query_dims[rank - 1];
+            k_len = transpose_key ? key_dims[rank - 2] : key_dims[rank - 1];
+            value_size = value_dims[rank - 1];
+            if ((transpose_key ? key_dims[rank - 1] : key_dims[rank - 2]) != head_size || value_dims[rank - 2] != k_len)
+                THROW_IE_EXCEPTION << layer->name << " Incorrect shapes of key and value inputs!";
+
+            std::vector<DataConfigurator> in_confs(layer->insData.size(), DataConfigurator(ConfLayout::PLN, Precision::FP32));
+            if (layer->insData.size() == 4) {
+                has_mask = true;
+                initMaskStrides(layer, query_dims);
+            }
+
+            addConfig(layer, in_confs, { DataConfigurator(ConfLayout::PLN, Precision::FP32) });
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        const float *query = inputs[QUERY]->cbuffer().as<const float *>() +
+            inputs[QUERY]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const float *key = inputs[KEY]->cbuffer().as<const float *>() +
+            inputs[KEY]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const float *value = inputs[VALUE]->cbuffer().as<const float *>() +
+            inputs[VALUE]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const float *mask = has_mask ? inputs[MASK]->cbuffer().as<const float *>() +
+            inputs[MASK]->getTensorDesc().getBlockingDesc().getOffsetPadding() : nullptr;
+        float *dst = outputs[0]->buffer().as<float *>() +
+            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        const int threads = parallel_get_max_threads();
+
+        // smaller query blocks keep all threads busy for short sequences and small batches
+        size_t q_block = max_q_block;
+        while (q_block > min_q_block && batch * div_up(q_len, q_block) < static_cast<size_t>(2 * threads))
+            q_block /= 2;
+        const size_t q_blocks = div_up(q_len, q_block);
+
+        const size_t thread_scratch_size = head_size * k_block + max_q_block * (k_block + value_size + 2);
+        if (scratch.size() < threads * thread_scratch_size)
+            scratch.resize(threads * thread_scratch_size);
+
+        parallel_nt(threads, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(batch * q_blocks, nthr, ithr, start, end);
+            float *thread_scratch = &scratch[ithr * thread_scratch_size];
+            for (size_t work = start; work < end; work++) {
+                const size_t b = work / q_blocks;
+                const size_t q_begin = (work % q_blocks) * q_block;
+                attention(b, q_begin, (std::min)(q_begin + q_block, q_len), query, key, value, mask, dst, thread_scratch);
+            }
+        });
+
+        return OK;
+    }
+
+private:
+    void initMaskStrides(const CNNLayer* layer, const SizeVector& query_dims) {
+        const size_t rank = query_dims.size();
+        SizeVector scores_dims = query_dims;
+        scores_dims[rank - 1] = k_len;
+
+        SizeVector mask_dims = layer->insData[MASK].lock()->getTensorDesc().getDims();
+        if (mask_dims.size() > rank)
+            THROW_IE_EXCEPTION << layer->name << " Mask rank is greater than the attention scores rank!";
+        mask_dims.insert(mask_dims.begin(), rank - mask_dims.size(), 1);
+
+        SizeVector mask_strides(rank, 0);
+        size_t stride = 1;
+        for (size_t i = rank; i-- > 0;) {
+            if (mask_dims[i] != scores_dims[i] && mask_dims[i] != 1)
+                THROW_IE_EXCEPTION << layer->name << " Mask isn't broadcastable to the attention scores!";
+            mask_strides[i] = mask_dims[i] == 1 ? 0 : stride;
+            stride *= mask_dims[i];
+        }
+        mask_row_stride = mask_strides[rank - 2];
+        mask_col_stride = mask_strides[rank - 1];
+
+        mask_batch_offsets.assign(batch, 0);
+        for (size_t b = 0; b < batch; b++) {
+            size_t rest = b;
+            for (size_t i = rank - 2; i-- > 0;) {
+                mask_batch_offsets[b] += (rest % scores_dims[i]) * mask_strides[i];
+                rest /= scores_dims[i];
+            }
+        }
+    }
+
+    void attention(size_t b, size_t q_begin, size_t q_end, const float *query, const float *key, const float *value,
+                   const float *mask, float *dst, float *thread_scratch) const {
+        const size_t rows = q_end - q_begin;
+        const float *q = query + (b * q_len + q_begin) * head_size;
+        const float *k = key + b * k_len * head_size;
+        const float *v = value + b * k_len * value_size;
+
+        float *key_tile = thread_scratch;
+        float *scores = key_tile + head_size * k_block;
+        float *acc = scores + max_q_block * k_block;
+        float *row_max = acc + max_q_block * value_size;
+        float *row_sum = row_max + max_q_block;
+
+        std::fill_n(acc, rows * value_size, 0.f);
+        std::fill_n(row_max, rows, -std::numeric_limits<float>::infinity());
+        std::fill_n(row_sum, rows, 0.f);
+
+        for (size_t k_begin = 0; k_begin < k_len; k_begin += k_block) {
+            const size_t cols = (std::min)(k_block, k_len - k_begin);
+
+            // the key block is used as [head_size x cols], so scores are accumulated along contiguous rows
+            const float *k_tile = k + k_begin;
+            size_t k_stride = k_len;
+            if (transpose_key) {
+                for (size_t j = 0; j < cols; j++) {
+                    const float *k_row = k + (k_begin + j) * head_size;
+                    for (size_t d = 0; d < head_size; d++)
+                        key_tile[d * cols + j] = k_row[d];
+                }
+                k_tile = key_tile;
+                k_stride = cols;
+            }
+
+            // scores of register blocks of query rows, every loaded key element is used by all rows of the block
+            size_t r = 0;
+            for (; r + row_block <= rows; r += row_block)
+                gemm_block<row_block>(q + r * head_size, head_size, k_tile, k_stride, head_size, cols,
+                                      scores + r * k_block, k_block, true);
+            for (; r < rows; r++)
+                gemm_block<1>(q + r * head_size, head_size, k_tile, k_stride, head_size, cols,
+                              scores + r * k_block, k_block, true);
+
+            for (size_t r = 0; r < rows; r++) {
+                float *s = scores + r * k_block;
+                for (size_t j = 0; j < cols; j++)
+                    s[j] *= scale;
+                if (mask) {
+                    const float *m = mask + mask_batch_offsets[b] + (q_begin + r) * mask_row_stride + k_begin * mask_col_stride;
+                    for (size_t j = 0; j < cols; j++)
+                        s[j] += m[j * mask_col_stride];
+                }
+
+                const float new_max = (std::max)(row_max[r], *std::max_element(s, s + cols));
+                if (new_max == -std::numeric_limits<float>::infinity()) {
+                    // the row is fully masked so far, nothing is accumulated
+                    std::fill_n(s, cols, 0.f);
+                    continue;
+                }
+
+                // rescale the accumulated row to the new maximum
+                const float correction = std::exp(row_max[r] - new_max);
+                float sum = 0.f;
+                for (size_t j = 0; j < cols; j++) {
+                    s[j] = std::exp(s[j] - new_max);
+                    sum += s[j];
+                }
+                row_sum[r] = row_sum[r] * correction + sum;
+                row_max[r] = new_max;
+
+                if (correction != 1.f) {
+                    float *o = acc + r * value_size;
+                    for (size_t dv = 0; dv < value_size; dv++)
+                        o[dv] *= correction;
+                }
+            }
+
+            // the same register blocking accumulates probabilities x values
+            const float *v_tile = v + k_begin * value_size;
+            for (r = 0; r + row_block <= rows; r += row_block)
+                gemm_block<row_block>(scores + r * k_block, k_block, v_tile, value_size, cols, value_size,
+                                      acc + r * value_size, value_size, false);
+            for (; r < rows; r++)
+                gemm_block<1>(scores + r * k_block, k_block, v_tile, value_size, cols, value_size,
+                              acc + r * value_size, value_size, false);
+        }
+
+        float *d = dst + (b * q_len + q_begin) * value_size;
+        for (size_t r = 0; r < rows; r++) {
+            const float norm = 1.f / row_sum[r];
+            for (size_t dv = 0; dv < value_size; dv++)
+                d[r * value_size + dv] = acc[r * value_size + dv] * norm;
+        }
+    }
+
+    /**
+     * C[ROWS x n] (+)= A[ROWS x k] x B[k x n] with row strides lda, ldb and ldc.
+     * Columns are processed by register blocks of ROWS x col_block accumulators that stay in vector registers
+     * while the whole k dimension is traversed, so every loaded element of B is reused ROWS times.
+     */
+    template <size_t ROWS>
+    static void gemm_block(const float *a, size_t lda, const float *b, size_t ldb, size_t k, size_t n,
+                           float *c, size_t ldc, bool overwrite) {
+        size_t j0 = 0;
+        for (; j0 + col_block <= n; j0 += col_block) {
+            float sums[ROWS][col_block];
+            for (size_t r = 0; r < ROWS; r++)
+                for (size_t j = 0; j < col_block; j++)
+                    sums[r][j] = overwrite ? 0.f : c[r * ldc + j0 + j];
+            for (size_t i = 0; i < k; i++) {
+                const float *b_row = b + i * ldb + j0;
+                for (size_t r = 0; r < ROWS; r++) {
+                    const float a_val = a[r * lda + i];
+                    for (size_t j = 0; j < col_block; j++)
+                        sums[r][j] += a_val * b_row[j];
+                }
+            }
+            for (size_t r = 0; r < ROWS; r++)
+                for (size_t j = 0; j < col_block; j++)
+                    c[r * ldc + j0 + j] = sums[r][j];
+        }
+        if (j0 == n)
+            return;
+
+        // the tail of columns is accumulated in memory
+        for (size_t r = 0; r < ROWS; r++) {
+            float *c_row = c + r * ldc;
+            if (overwrite)
+                std::fill(c_row + j0, c_row + n, 0.f);
+            for (size_t i = 0; i < k; i++) {
+                const float a_val = a[r * lda + i];
+                const float *b_row = b + i * ldb;
+                for (size_t j = j0; j < n; j++)
+                    c_row[j] += a_val * b_row[j];
+            }
+        }
+    }
+
+    static size_t div_up(size_t a, size_t b) {
+        return (a + b - 1) / b;
+    }
+
+    const size_t QUERY = 0;
+    const size_t KEY = 1;
+    const size_t VALUE = 2;
+    const size_t MASK = 3;
+
+    // key and value blocks of k_block rows stay in L2 cache for the typical head sizes of 64-128
+    const size_t k_block = 64;
+    const size_t max_q_block = 32;
+    const size_t min_q_block = 4;
+    // register blocks of the score and value products: 4 x 16 accumulators fill 8 AVX2 or 4 AVX-512 registers
+    static constexpr size_t row_block = 4;
+    static constexpr size_t col_block = 16;
+
+    float scale = 1.f;
+    bool transpose_key = true;
+    bool has_mask = false;
+
+    size_t batch = 1;
+    size_t q_len = 0;
+    size_t k_len = 0;
+    size_t head_size = 0;
+    size_t value_size = 0;
+
+    size_t mask_row_stride = 0;
+    size_t mask_col_stride = 0;
+    std::vector<size_t> mask_batch_offsets;
+
+    std::vector<float> scratch;
+};
+
+REG_FACTORY_FOR(ScaledDotProductAttentionImpl, ScaledDotProductAttention);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
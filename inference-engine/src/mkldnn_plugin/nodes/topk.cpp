@@ -11,6 +11,8 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <algorithm>
+#include <utility>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -445,6 +447,73 @@ public:
         });
     }
 
+    // TopK over a few very long rows: every row is split into chunks selected by different threads,
+    // then the partial results of the row are merged. Elements are ordered by value and then by index,
+    // so the result matches the stable selection of topk().
+    template <template <typename> class Compare>
+    void topk_split(const float* src_data, float* dst_data, int* dst_idx, int num_chunks) {
+        typedef std::pair<float, int> value_index;
+        auto better = [](const value_index& l, const value_index& r) {
+            return Compare<float>()(l.first, r.first) || (l.first == r.first && l.second < r.second);
+        };
+
+        const int chunk_len = (dim + num_chunks - 1) / num_chunks;
+        split_values.resize(static_cast<size_t>(before_num) * num_chunks * src_k);
+        split_counts.resize(static_cast<size_t>(before_num) * num_chunks);
+
+        parallel_for2d(before_num, num_chunks, [&](int i0, int ic) {
+            const int begin = ic * chunk_len;
+            const int end = (std::min)(begin + chunk_len, dim);
+            const int top_count = (std::max)(0, (std::min)(src_k, end - begin));
+            const float* src = src_data + i0 * dim;
+            value_index* top = &split_values[(static_cast<size_t>(i0) * num_chunks + ic) * src_k];
+
+            if (top_count * heap_select_ratio <= end - begin) {
+                // the worst of selected elements is kept on the top of the heap
+                for (int i = 0; i < top_count; i++)
+                    top[i] = value_index(src[begin + i], begin + i);
+                std::make_heap(top, top + top_count, better);
+                for (int i = begin + top_count; i < end; i++) {
+                    if (better(value_index(src[i], i), top[0])) {
+                        std::pop_heap(top, top + top_count, better);
+                        top[top_count - 1] = value_index(src[i], i);
+                        std::push_heap(top, top + top_count, better);
+                    }
+                }
+            } else {
+                std::vector<value_index> chunk(end - begin);
+                for (int i = begin; i < end; i++)
+                    chunk[i - begin] = value_index(src[i], i);
+                std::nth_element(chunk.begin(), chunk.begin() + (top_count - 1), chunk.end(), better);
+                std::copy(chunk.begin(), chunk.begin() + top_count, top);
+            }
+            split_counts[i0 * num_chunks + ic] = top_count;
+        });
+
+        parallel_for(before_num, [&](int i0) {
+            std::vector<value_index> candidates;
+            candidates.reserve(static_cast<size_t>(num_chunks) * src_k);
+            for (int ic = 0; ic < num_chunks; ic++) {
+                const value_index* top = &split_values[(static_cast<size_t>(i0) * num_chunks + ic) * src_k];
+                candidates.insert(candidates.end(), top, top + split_counts[i0 * num_chunks + ic]);
+            }
+            std::partial_sort(candidates.begin(), candidates.begin() + src_k, candidates.end(), better);
+            if (!sort_value) {
+                std::sort(candidates.begin(), candidates.begin() + src_k, [](const value_index& l, const value_index& r) {
+                    return l.second < r.second;
+                });
+            }
+            if (dst_data) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    dst_data[i0 * src_k + i2] = candidates[i2].first;
+            }
+            if (dst_idx) {
+                for (int i2 = 0; i2 < src_k; i2++)
+                    dst_idx[i0 * src_k + i2] = candidates[i2].second;
+            }
+        });
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -499,7 +568,18 @@ public:
 
         SizeVector in_dims = inputs[TOPK_DATA]->getTensorDesc().getDims();
 
-        if (src_k == 1) {
+        // rows are too few to occupy all threads, so the reduction axis is split between them
+        int num_chunks = 1;
+        if (is_last_dim && src_k > 0 && dim >= split_min_chunk * 2 && before_num < parallel_get_max_threads()) {
+            num_chunks = (std::min)((parallel_get_max_threads() + before_num - 1) / before_num, dim / split_min_chunk);
+        }
+
+        if (num_chunks > 1) {
+            if (mode_max)
+                topk_split<std::greater>(src, dst_data, dst_idx, num_chunks);
+            else
+                topk_split<std::less>(src, dst_data, dst_idx, num_chunks);
+        } else if (src_k == 1) {
             if (is_last_dim) {
                 if (mode_max)
                     top1<std::greater>(src, dst_data, dst_idx, in_dims);
@@ -547,6 +627,13 @@ private:
 
     int dim, before_num;
 
+    // minimal number of elements processed by a thread when the reduction axis is split
+    const int split_min_chunk = 16384;
+    // a heap is used to select up to chunk_len / heap_select_ratio elements, nth_element is faster for more
+    const int heap_select_ratio = 8;
+    std::vector<std::pair<float, int>> split_values;
+    std::vector<int> split_counts;
+
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
 #elif defined(HAVE_SSE) || defined(HAVE_AVX2)
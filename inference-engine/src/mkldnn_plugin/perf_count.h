@@ -4,21 +4,58 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+/**
+ * Single execution of a node on the timeline of the detailed profiling.
+ */
+struct PerfSample {
+    uint64_t start;     // ns since the clock epoch
+    uint64_t duration;  // ns
+    size_t thread;      // hash of the executing thread id
+};
+
 class PerfCount {
-    uint64_t duration;
+    uint64_t duration;  // ns
     uint32_t num;
+    uint64_t minDuration = std::numeric_limits<uint64_t>::max();
+    uint64_t maxDuration = 0;
+
+    bool detailed = false;
+    std::vector<PerfSample> samples;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
 public:
+    // The timeline keeps first iterations only to bound the memory of long runs, min/max/avg count all of them
+    static constexpr size_t maxSamples = 1 << 16;
+
+    // Bytes moved and operations done by a single execution, estimated from the node shapes
+    uint64_t bytesRead = 0;
+    uint64_t bytesWritten = 0;
+    uint64_t flops = 0;
+
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    uint64_t avg() { return (num == 0) ? 0 : duration / num / 1000; }
+
+    uint32_t count() const { return num; }
+    uint64_t minNs() const { return (num == 0) ? 0 : minDuration; }
+    uint64_t maxNs() const { return maxDuration; }
+    uint64_t avgNs() const { return (num == 0) ? 0 : duration / num; }
+
+    void enableDetailed() { detailed = true; }
+    bool isDetailed() const { return detailed; }
+    const std::vector<PerfSample>& getSamples() const { return samples; }
 
 private:
     void start_itr() {
@@ -28,8 +65,16 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        uint64_t itr = std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
+        duration += itr;
         num++;
+        minDuration = std::min(minDuration, itr);
+        maxDuration = std::max(maxDuration, itr);
+
+        if (detailed && samples.size() < maxSamples) {
+            uint64_t start = std::chrono::duration_cast<std::chrono::nanoseconds>(__start.time_since_epoch()).count();
+            samples.push_back({start, itr, std::hash<std::thread::id>()(std::this_thread::get_id())});
+        }
     }
 
     friend class PerfHelper;
@@ -32,6 +32,36 @@ namespace PluginConfigInternalParams {
  */
 DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
 
+/**
+ * @brief Defines a mode of collapsing chains of elementwise operations into JIT compiled snippets
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(SNIPPETS_MODE);
+
+/**
+ * @brief Defines a mode of dynamic INT8 quantization of FullyConnected layers in FP32 models:
+ *        weights are quantized at load time, activations are quantized on every inference
+ *        with scales computed either for the whole tensor (PER_TENSOR) or for every row (PER_ROW)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(DYNAMIC_QUANTIZATION);
+DECLARE_CONFIG_VALUE(PER_TENSOR);
+DECLARE_CONFIG_VALUE(PER_ROW);
+
+/**
+ * @brief Enables concurrent execution of independent branches of the graph by threads of the CPU stream
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(INTER_OP_PARALLELISM);
+
+/**
+ * @brief Path of the JSON file receiving the detailed per-node profile of the CPU plugin: latency distribution,
+ * memory traffic and arithmetic of every node and the timeline of all streams in the Chrome trace format.
+ * The file is written when the executable network is destroyed. Empty string switches the profiling off.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(DETAILED_PERF_COUNT);
+
 /**
  * @brief Limit \#threads that are used by CPU Executor Streams to execute `parallel_for` calls
  * @ingroup ie_dev_api_plugin_api
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_cpu_topology.hpp
+ * @brief A header file for the CPU topology discovered from Linux sysfs
+ */
+
+#pragma once
+
+#include <ie_api.h>
+
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Describes logical CPUs usable by the process: physical cores, SMT siblings, cache sharing groups and NUMA nodes
+ * @ingroup ie_dev_api_threading
+ */
+struct INFERENCE_ENGINE_API_CLASS(CpuTopology) {
+    /**
+     * @brief Describes a logical CPU
+     */
+    struct Processor {
+        int _cpu        = 0;  //!< Logical CPU id as used by `sched_setaffinity`
+        int _socket     = 0;  //!< Physical package id
+        int _core       = 0;  //!< Index of the physical core, unique across packages
+        int _smtRank    = 0;  //!< Index of the logical CPU among SMT siblings of the core, `0` for the first hyper-thread
+        int _numaNode   = 0;  //!< NUMA node id
+        int _l2Group    = 0;  //!< Index of the group of logical CPUs that share the L2 cache
+        int _l3Group    = 0;  //!< Index of the group of logical CPUs that share the L3 cache
+    };
+
+    std::vector<Processor> _processors;  //!< Online, non-isolated logical CPUs, sorted by id
+
+    /**
+     * @brief Checks whether the topology was discovered
+     * @return `true` if there are no known logical CPUs
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns number of physical cores
+     * @return Number of physical cores with at least one usable logical CPU
+     */
+    int GetCoresNumber() const;
+
+    /**
+     * @brief Returns NUMA nodes ids
+     * @return Sorted ids of NUMA nodes with at least one usable logical CPU
+     */
+    std::vector<int> GetNumaNodes() const;
+
+    /**
+     * @brief Returns groups of physical cores that share the L2 cache
+     * @return Logical CPU ids of the first hyper-thread of every core, grouped by L2 cache and ordered by NUMA node
+     */
+    std::vector<std::vector<int>> GetCacheGroups() const;
+
+    /**
+     * @brief Returns the order to pin threads in, so neighbouring thread indices share caches
+     *        and SMT siblings are used only after all physical cores are occupied
+     * @return Logical CPU ids
+     */
+    std::vector<int> GetPinningOrder() const;
+
+    /**
+     * @brief Returns the copy of the topology restricted to given logical CPUs
+     * @param cpus Allowed logical CPU ids
+     * @return The restricted topology
+     */
+    CpuTopology Restrict(const std::vector<int>& cpus) const;
+};
+
+/**
+ * @brief Parses the CPU topology from the sysfs tree
+ * @ingroup ie_dev_api_threading
+ * @param sysfsRoot A path to the sysfs mount point, fake trees are used in tests
+ * @return The CPU topology, empty if the tree does not describe online CPUs
+ */
+INFERENCE_ENGINE_API_CPP(CpuTopology) ParseCpuTopology(const std::string& sysfsRoot);
+
+/**
+ * @brief Returns the CPU topology of the host restricted by the process affinity mask
+ * @ingroup ie_dev_api_threading
+ * @return The topology parsed once from `/sys` on Linux, empty on other OSes
+ */
+INFERENCE_ENGINE_API_CPP(const CpuTopology&) GetCpuTopology();
+
+}  // namespace InferenceEngine
@@ -29,6 +29,8 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -38,6 +40,8 @@ public:
     void clear(const std::string& id = {});
 
 private:
+    IStreamsExecutor::Ptr getCPUStreamsExecutor(const IStreamsExecutor::Config& config, bool shared);
+
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
     std::mutex streamExecutorMutex;
@@ -83,6 +87,14 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns streams executor with the same configuration even if it is already used,
+     *        so tasks of all its users are ordered by IStreamsExecutor::Priority in the single queue
+     * @param config Streams executor configuration
+     * @return A shared pointer to existing or newly created IStreamsExecutor
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     /**
      * @cond
      */
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <string>
@@ -44,6 +45,15 @@ public:
         NUMA     //!< Bind threads to NUMA nodes
     };
 
+    /**
+     * @brief Defines the order in which queued tasks are dispatched to streams
+     */
+    enum Priority : std::uint8_t {
+        LOW,     //!< Dispatched only when no task of higher priority is queued
+        MEDIUM,  //!< Default priority of tasks started with ITaskExecutor::run()
+        HIGH     //!< Dispatched before any queued task of lower priority
+    };
+
     /**
      * @brief Defines IStreamsExecutor configuration
      */
@@ -118,6 +128,18 @@ public:
      */
     ~IStreamsExecutor() override;
 
+    using ITaskExecutor::run;
+
+    /**
+    * @brief Queues the task with the priority and the deadline.
+    *        Queued tasks are dispatched in the order of priority, then of deadline, then of submission.
+    *        The default implementation ignores the priority and the deadline and calls run(task)
+    * @param task A task to start
+    * @param priority A priority of the task
+    * @param deadline A time point the task should be started before, `time_point::max()` means no deadline
+    */
+    virtual void run(Task task, Priority priority, std::chrono::steady_clock::time_point deadline);
+
     /**
     * @brief Return the index of current stream
     * @return An index of current stream. Or throw exceptions if called not from stream thread
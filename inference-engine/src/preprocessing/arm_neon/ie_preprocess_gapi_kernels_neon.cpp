@@ -127,6 +127,22 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void convertRow_FP16ToF32(const uint16_t in[], float out[], int length) {
+    convertRow_FP16ToF32_impl(in, out, length);
+}
+
+void convertRow_F32ToFP16(const float in[], uint16_t out[], int length) {
+    convertRow_F32ToFP16_impl(in, out, length);
+}
+
+void convertRow_BF16ToF32(const uint16_t in[], float out[], int length) {
+    convertRow_BF16ToF32_impl(in, out, length);
+}
+
+void convertRow_F32ToBF16(const float in[], uint16_t out[], int length) {
+    convertRow_F32ToBF16_impl(in, out, length);
+}
+
 template<int chanNum>
 CV_ALWAYS_INLINE void channels2planes_store(std::array<std::array<uint8_t*, 4>, chanNum>& dst,
                                             const uchar* src, const int width,
@@ -199,6 +199,14 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void convertRow_FP16ToF32(const uint16_t in[], float out[], int length);
+
+void convertRow_F32ToFP16(const float in[], uint16_t out[], int length);
+
+void convertRow_BF16ToF32(const uint16_t in[], float out[], int length);
+
+void convertRow_F32ToBF16(const float in[], uint16_t out[], int length);
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -10,6 +10,7 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <iterator>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -35,7 +36,7 @@ int get_cv_depth(const TensorDesc &ie_desc);
 namespace G {
     struct Strides {int N; int C; int H; int W;};
     struct Dims    {int N; int C; int H; int W;};
-    struct Desc    {Dims d; Strides s; int prec;};
+    struct Desc    {Dims d; Strides s; int prec; Precision ie_prec;};
 
     void fix_strides_nhwc(const Dims &d, Strides &s) {
         if (s.W > d.C) {
@@ -68,7 +69,7 @@ namespace G {
 
         if (nhwc_layout) fix_strides_nhwc(d, s);
 
-        return Desc{d, s, get_cv_depth(ie_desc)};
+        return Desc{d, s, get_cv_depth(ie_desc), ie_desc.getPrecision()};
     }
 
     Desc decompose(const Blob::Ptr& blob) {
@@ -82,6 +83,7 @@ inline int get_cv_depth(const TensorDesc &ie_desc) {
     case Precision::FP32: return CV_32F;
     case Precision::U16:  return CV_16U;
     case Precision::FP16: return CV_16U;
+    case Precision::BF16: return CV_16U;
 
     default: THROW_IE_EXCEPTION << "Unsupported data type";
     }
@@ -631,14 +633,41 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     const int tmp_prec = CV_32F;
 
-    std::vector<cv::GMat> outputs;
+    // FP16 and BF16 travel as CV_16U, so their values are converted by the dedicated kernels
+    const auto is_f16 = [](const G::Desc& desc) {
+        return desc.ie_prec == Precision::FP16 || desc.ie_prec == Precision::BF16;
+    };
+    const auto f16_format = [](const G::Desc& desc) {
+        return desc.ie_prec == Precision::BF16 ? gapi::BF16 : gapi::FP16;
+    };
+    const auto for_each_plane = [](const std::vector<cv::GMat>& src_gmats,
+                                   const std::function<cv::GMat(const cv::GMat&)>& f) {
+        std::vector<cv::GMat> dst_gmats;
+        std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), f);
+        return dst_gmats;
+    };
+
     const bool resize_needed = (algorithm != NO_RESIZE);
-    const bool need_tmp_prec_conv = resize_needed && (in_desc.prec != CV_8U) && (in_desc.prec != CV_32F);
+    // Plain copy of 16-bit floats needs no conversion at all
+    const bool keep_f16 = !resize_needed && is_f16(in_desc) && in_desc.ie_prec == out_desc.ie_prec;
+
+    std::vector<cv::GMat> outputs = planes;
+    int prec = in_desc.prec;
+
+    if (is_f16(in_desc) && !keep_f16) {
+        outputs = for_each_plane(outputs, [&](const cv::GMat& m) {
+            return gapi::ConvertFromF16::on(m, f16_format(in_desc));
+        });
+        prec = tmp_prec;
+    } else if (resize_needed && (prec != CV_8U) && (prec != CV_32F)) {
+        outputs = for_each_plane(outputs, [&](const cv::GMat& m) {
+            return gapi::ConvertDepth::on(m, tmp_prec);
+        });
+        prec = tmp_prec;
+    }
 
     if (resize_needed) {
         // resize every plane
-        std::vector<cv::GMat> out_planes;
-        out_planes.reserve(planes.size());
         const int interp_type = [](const ResizeAlgorithm &ar) {
             switch (ar) {
             case RESIZE_AREA:     return cv::INTER_AREA;
@@ -647,34 +676,26 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             }
         } (algorithm);
 
-        std::transform(planes.begin(), planes.end(), std::back_inserter(out_planes), [&](const cv::GMat& m) {
-            const auto input_sz  = cv::gapi::own::Size(in_desc.d.W, in_desc.d.H);
-            const auto scale_sz  = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
-
-            cv::GMat converted = m;
-            int prec = in_desc.prec;
-
-            if (need_tmp_prec_conv) {
-                std::tie(converted, prec) = std::make_tuple(gapi::ConvertDepth::on(m, tmp_prec), tmp_prec);
-            }
-
-            return gapi::ScalePlane::on(converted, prec, input_sz, scale_sz, interp_type);
+        const auto input_sz  = cv::gapi::own::Size(in_desc.d.W, in_desc.d.H);
+        const auto scale_sz  = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
+        outputs = for_each_plane(outputs, [&](const cv::GMat& m) {
+            return gapi::ScalePlane::on(m, prec, input_sz, scale_sz, interp_type);
         });
-        outputs = out_planes;
-    } else {
-        outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
-        auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
-            std::vector<cv::GMat> dst_gmats;
-            std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
-                return gapi::ConvertDepth::on(m, dst_precision);
+    if (is_f16(out_desc) && !keep_f16) {
+        if (prec != tmp_prec) {
+            outputs = for_each_plane(outputs, [&](const cv::GMat& m) {
+                return gapi::ConvertDepth::on(m, tmp_prec);
             });
-            return dst_gmats;
-        };
-
-        outputs = convert_prec(outputs, out_desc.prec);
+        }
+        outputs = for_each_plane(outputs, [&](const cv::GMat& m) {
+            return gapi::ConvertToF16::on(m, f16_format(out_desc));
+        });
+    } else if (prec != out_desc.prec) {
+        outputs = for_each_plane(outputs, [&](const cv::GMat& m) {
+            return gapi::ConvertDepth::on(m, out_desc.prec);
+        });
     }
     // convert to interleaved if NHWC is required as output
     if (out_layout == NHWC) {
@@ -685,9 +706,11 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+constexpr size_t PreprocEngine::defaultCacheCapacity;
+
+PreprocEngine::PreprocEngine(size_t cacheCapacity) : _cacheCapacity(std::max<size_t>(cacheCapacity, 1)) {}
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
     // 0. This is the first call ever
@@ -696,14 +719,10 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::tie(last_in, last_out, last_algo) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
@@ -761,6 +780,19 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
+    // a batch of ROIs is applicable if every ROI is applicable and there is a batch slot for it
+    if (auto rois = as<BatchedROIBlob>(src)) {
+        const auto &dst_dims = dst->getTensorDesc().getDims();
+        if (!dst_dims.empty() && rois->size() > dst_dims[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of ROIs exceeds network's batch size: "
+                               << rois->size() << " > " << dst_dims[0];
+        }
+        for (size_t i = 0; i < rois->size(); i++) {
+            checkApplicabilityGAPI(rois->getBlob(i), dst);
+        }
+        return;
+    }
+
     // src is either a memory blob, an NV12, or an I420 blob
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
     if (!src->is<MemoryBlob>() && !yuv420_blob) {
@@ -799,7 +831,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<BatchedROIBlob>()) {
+        // one ROI per batch, a smaller batch set on the infer request takes the first ROIs only
+        const int rois = static_cast<int>(blob->size());
+        if (batch > rois) {
+            THROW_IE_EXCEPTION  << "Provided batch size " << batch
+                                << " exceeds the number of ROIs " << rois;
+        }
+        if (batch < 0) {
+            batch = rois;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -815,6 +857,7 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
 }
 
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+    std::vector<cv::GCompiled>& compiled_slices,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
@@ -837,7 +880,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
+        auto& compiled = compiled_slices[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
@@ -947,12 +990,31 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         THROW_IE_EXCEPTION  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
+    // The whole descriptor including sizes is the key, so a hit never needs recompilation.
+    // On a miss a new entry is compiled unless the cache is full: then the least recently
+    // used entry is replaced and its graphs are just reshaped if only input sizes differ.
+    Update update = Update::REBUILD;
+    auto entry = std::find_if(_cache.begin(), _cache.end(), [&thisCall](const CacheEntry &e) {
+        return e.call == thisCall;
+    });
+    if (entry != _cache.end()) {
+        _cacheHits++;
+        update = Update::NOTHING;
+        _cache.splice(_cache.begin(), _cache, entry);
+    } else {
+        _cacheMisses++;
+        if (_cache.size() >= _cacheCapacity) {
+            update = needUpdate(_cache.back().call, thisCall);
+            _cache.splice(_cache.begin(), _cache, std::prev(_cache.end()));
+            _cache.front().call = std::move(thisCall);
+        } else {
+            _cache.push_front(CacheEntry{std::move(thisCall), std::vector<cv::GCompiled>(parallel_get_max_threads())});
+        }
+    }
+    auto& compiled = _cache.front().compiled;
 
     Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
         if (Update::REBUILD == update) {
             //  rebuild the graph
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
@@ -972,10 +1034,160 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    try {
+        executeGraph(_lastComputation, compiled, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+            omp_serial, update);
+    } catch (...) {
+        // Graphs of the entry may be partially compiled
+        _cache.pop_front();
+        throw;
+    }
 }
 
+template<typename BlobTypePtr>
+void PreprocEngine::preprocessBatchedROIs(const std::vector<BlobTypePtr> &rois, MemoryBlob::Ptr &outBlob,
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial) {
+
+    const auto& out_desc_ie = outBlob->getTensorDesc();
+    validateTensorDesc(out_desc_ie);
+
+    const auto out_layout = out_desc_ie.getLayout();
+    const G::Desc out_desc = G::decompose(out_desc_ie);
+
+    const int batch_size = static_cast<int>(rois.size());
+    if (batch_size > out_desc.d.N) {
+        THROW_IE_EXCEPTION  << "Provided number of ROIs is invalid: (provided)"
+                            << batch_size << " > " << out_desc.d.N << " (expected by network)";
+    }
+
+    // All ROIs are taken from the same image, so only their sizes differ
+    std::vector<G::Desc> in_descs;
+    in_descs.reserve(rois.size());
+    for (const auto& roi : rois) {
+        validateBlob(roi);
+        const auto& in_desc_ie = getTensorDescAndLayout(roi).first;
+        validateTensorDesc(in_desc_ie);
+        in_descs.push_back(G::decompose(in_desc_ie));
+    }
+    const auto& in_desc_ie = getTensorDescAndLayout(rois[0]).first;
+    const auto  in_layout  = getTensorDescAndLayout(rois[0]).second;
+
+    CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                            in_layout,
+                                            SizeVector{},
+                                            in_fmt },
+                                  BlobDesc{ out_desc_ie.getPrecision(),
+                                            out_layout,
+                                            out_desc_ie.getDims(),
+                                            out_fmt },
+                                  algorithm };
+
+    if (!_batchedROIs || _batchedROIs->call != thisCall) {
+        const auto threads = static_cast<size_t>(parallel_get_max_threads());
+        _batchedROIs.reset(new BatchedROIEntry());
+        _batchedROIs->call = std::move(thisCall);
+        _batchedROIs->compiled.resize(threads);
+        _batchedROIs->compiledSizes.resize(threads);
+    }
+    auto& entry = *_batchedROIs;
+
+    std::vector<int> kinds(batch_size, 0);
+    for (int i = 0; i < batch_size; ++i) {
+        const auto& in_dims = in_descs[i].d;
+        if (algorithm == RESIZE_AREA && (in_dims.H < out_desc.d.H || in_dims.W < out_desc.d.W)) {
+            kinds[i] = 1;
+        }
+
+        auto& computation = entry.computations[kinds[i]];
+        if (!computation.has_value()) {
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+            computation = cv::util::make_optional(
+                buildGraph(getGDesc(in_descs[i], rois[i]),
+                           out_desc,
+                           in_layout,
+                           out_layout,
+                           algorithm,
+                           in_fmt,
+                           out_fmt));
+        }
+    }
+
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        batched_input_plane_mats[i] = std::move(bind_to_blob(rois[i], 1)[0]);
+    }
+    auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        0;                  // use all available threads
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // Unlike executeGraph() ROIs are distributed among threads rather than rows of a single image:
+    // there are usually enough of them to load all threads, and no thread waits for another one.
+    try {
+        parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
+
+            for (int i = slice_n; i < batch_size; i += total_slices) {
+                const auto& input_plane_mats = batched_input_plane_mats[i];
+                auto& output_plane_mats = batched_output_plane_mats[i];
+
+                auto& compiled = entry.compiled[slice_n][kinds[i]];
+                auto& compiled_size = entry.compiledSizes[slice_n][kinds[i]];
+                const auto roi_size = cv::gapi::own::Size(input_plane_mats[0].cols, input_plane_mats[0].rows);
+                if (!compiled || !(compiled_size == roi_size)) {
+                    OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+
+                    // the whole output is produced by this thread, so no output ROIs are set
+                    auto args = cv::compile_args(gapi::preprocKernels());
+                    if (!compiled) {
+                        auto& computation = entry.computations[kinds[i]].value();
+                        compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
+                    } else {
+                        compiled.reshape(descrs_of(input_plane_mats), std::move(args));
+                    }
+                    compiled_size = roi_size;
+                }
+
+                cv::GRunArgs call_ins;
+                cv::GRunArgsP call_outs;
+                for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+                for (auto & m : output_plane_mats) { call_outs.emplace_back(&m);}
+
+                OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_graph);
+                compiled(std::move(call_ins), std::move(call_outs));
+            }
+        });
+    } catch (...) {
+        // Per-thread graphs may be partially compiled
+        _batchedROIs.reset();
+        throw;
+    }
+}
+
+namespace {
+template<typename BlobType>
+std::vector<typename BlobType::Ptr> getROIs(const BatchedROIBlob::Ptr &inBlob, int batch_size, ColorFormat in_fmt,
+                                            const char* expected) {
+    std::vector<typename BlobType::Ptr> rois;
+    rois.reserve(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        auto roi = as<BlobType>(inBlob->getBlob(i));
+        if (!roi) {
+            THROW_IE_EXCEPTION  << "Unsupported ROI blob for color format " << in_fmt
+                                << ": expected " << expected;
+        }
+        rois.push_back(std::move(roi));
+    }
+    return rois;
+}
+}  // anonymous namespace
+
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
         const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
@@ -986,6 +1198,21 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
         THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
+    // all ROIs of a batch are resized into their batch slots in a single pass
+    if (auto inROIBlob = as<BatchedROIBlob>(inBlob)) {
+        switch (in_fmt) {
+        case ColorFormat::NV12:
+            return preprocessBatchedROIs(getROIs<NV12Blob>(inROIBlob, batch_size, in_fmt, "NV12Blob"),
+                outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial);
+        case ColorFormat::I420:
+            return preprocessBatchedROIs(getROIs<I420Blob>(inROIBlob, batch_size, in_fmt, "I420Blob"),
+                outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial);
+        default:
+            return preprocessBatchedROIs(getROIs<MemoryBlob>(inROIBlob, batch_size, in_fmt, "MemoryBlob"),
+                outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial);
+        }
+    }
+
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
@@ -8,10 +8,14 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <array>
+#include <list>
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
+#include <opencv2/gapi/own/types.hpp>
 #include <opencv2/gapi/util/optional.hpp>
 #include <openvino/itt.hpp>
 
@@ -25,8 +29,28 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // Graphs compiled for recent calls, the most recently used one goes first.
+    // Every call descriptor keeps its own per-slice objects, so interleaved inputs of
+    // different shapes don't trigger recompilation.
+    struct CacheEntry {
+        CallDesc call;
+        std::vector<cv::GCompiled> compiled;
+    };
+    std::list<CacheEntry> _cache;
+    size_t _cacheCapacity;
+    size_t _cacheHits = 0;
+    size_t _cacheMisses = 0;
+
+    // ROIs of a BatchedROIBlob differ in sizes, so each of them is processed whole by a single thread
+    // which reshapes its graph to the ROI size. AREA resize uses different kernels for upscale and
+    // downscale, so up to two graphs (and per-thread objects) are kept, indexed by the upscale flag.
+    struct BatchedROIEntry {
+        CallDesc call;
+        std::array<Opt<cv::GComputation>, 2> computations;
+        std::vector<std::array<cv::GCompiled, 2>> compiled;
+        std::vector<std::array<cv::gapi::own::Size, 2>> compiledSizes;
+    };
+    std::unique_ptr<BatchedROIEntry> _batchedROIs;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -34,9 +58,10 @@ class PreprocEngine {
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      std::vector<cv::GCompiled>& compiled,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
@@ -48,12 +73,22 @@ class PreprocEngine {
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
         int batch_size);
 
+    template<typename BlobTypePtr>
+    void preprocessBatchedROIs(const std::vector<BlobTypePtr> &rois, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial);
+
 public:
-    PreprocEngine();
+    static constexpr size_t defaultCacheCapacity = 8;
+
+    explicit PreprocEngine(size_t cacheCapacity = defaultCacheCapacity);
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
         ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+
+    // Statistics of the compiled graph cache, checked by the fluid preprocessing tests
+    size_t cacheHits() const { return _cacheHits; }
+    size_t cacheMisses() const { return _cacheMisses; }
 };
 
 }  // namespace InferenceEngine
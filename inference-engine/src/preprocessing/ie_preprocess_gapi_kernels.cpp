@@ -2416,6 +2416,103 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+namespace {
+
+using convertFromF16Row_f = void (*)(const uint16_t in[], float out[], int length);
+using convertToF16Row_f   = void (*)(const float in[], uint16_t out[], int length);
+
+void convertRow_FP16ToF32_fallback(const uint16_t in[], float out[], int length) {
+    for (int i = 0; i < length; i++) out[i] = fp16_to_float(in[i]);
+}
+
+void convertRow_BF16ToF32_fallback(const uint16_t in[], float out[], int length) {
+    for (int i = 0; i < length; i++) out[i] = bf16_to_float(in[i]);
+}
+
+void convertRow_F32ToFP16_fallback(const float in[], uint16_t out[], int length) {
+    for (int i = 0; i < length; i++) out[i] = float_to_fp16(in[i]);
+}
+
+void convertRow_F32ToBF16_fallback(const float in[], uint16_t out[], int length) {
+    for (int i = 0; i < length; i++) out[i] = float_to_bf16(in[i]);
+}
+
+convertFromF16Row_f selectConvertFromF16Row(int format) {
+    const bool bf16 = format == BF16;
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        return bf16 ? avx512::convertRow_BF16ToF32 : avx512::convertRow_FP16ToF32;
+    }
+    #endif  // HAVE_AVX512
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        return bf16 ? avx::convertRow_BF16ToF32 : avx::convertRow_FP16ToF32;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        return bf16 ? convertRow_BF16ToF32 : convertRow_FP16ToF32;
+    }
+    #endif  // HAVE_SSE
+    #ifdef HAVE_NEON
+    return bf16 ? neon::convertRow_BF16ToF32 : neon::convertRow_FP16ToF32;
+    #endif  // HAVE_NEON
+
+    return bf16 ? convertRow_BF16ToF32_fallback : convertRow_FP16ToF32_fallback;
+}
+
+convertToF16Row_f selectConvertToF16Row(int format) {
+    const bool bf16 = format == BF16;
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        return bf16 ? avx512::convertRow_F32ToBF16 : avx512::convertRow_F32ToFP16;
+    }
+    #endif  // HAVE_AVX512
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        return bf16 ? avx::convertRow_F32ToBF16 : avx::convertRow_F32ToFP16;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        return bf16 ? convertRow_F32ToBF16 : convertRow_F32ToFP16;
+    }
+    #endif  // HAVE_SSE
+    #ifdef HAVE_NEON
+    return bf16 ? neon::convertRow_F32ToBF16 : neon::convertRow_F32ToFP16;
+    #endif  // HAVE_NEON
+
+    return bf16 ? convertRow_F32ToBF16_fallback : convertRow_F32ToFP16_fallback;
+}
+
+}  // namespace
+
+// Fluid runs these line by line together with the neighbouring kernels (e.g. resize),
+// so FP16/BF16 inputs and outputs cost no extra pass over the image
+GAPI_FLUID_KERNEL(FConvertFromF16, ConvertFromF16, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, int format, cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_16U && dst.meta().depth == CV_32F);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto length = dst.length() * dst.meta().chan;
+        selectConvertFromF16Row(format)(src.InLine<uint16_t>(0), dst.OutLine<float>(), length);
+    }
+};
+
+GAPI_FLUID_KERNEL(FConvertToF16, ConvertToF16, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, int format, cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_32F && dst.meta().depth == CV_16U);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto length = dst.length() * dst.meta().chan;
+        selectConvertToF16Row(format)(src.InLine<float>(0), dst.OutLine<uint16_t>(), length);
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2443,6 +2540,8 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FConvertFromF16
+        , FConvertToF16
         >();
 }
 
@@ -152,6 +152,28 @@ namespace gapi {
         }
     };
 
+    // G-API has no 16-bit floating point depth, so FP16 and BF16 data is carried in CV_16U
+    // matrices and the kernels below are told how to interpret it
+    enum F16Format : int { FP16 = 0, BF16 = 1 };
+
+    G_TYPED_KERNEL(ConvertFromF16, <cv::GMat(cv::GMat, int format)>, "com.intel.ie.ConvertFromF16") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, int format) {
+            GAPI_Assert(in.depth == CV_16U);
+            GAPI_Assert(format == FP16 || format == BF16);
+
+            return in.withDepth(CV_32F);
+        }
+    };
+
+    G_TYPED_KERNEL(ConvertToF16, <cv::GMat(cv::GMat, int format)>, "com.intel.ie.ConvertToF16") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, int format) {
+            GAPI_Assert(in.depth == CV_32F);
+            GAPI_Assert(format == FP16 || format == BF16);
+
+            return in.withDepth(CV_16U);
+        }
+    };
+
 
 
     cv::gapi::GKernelPackage preprocKernels();
@@ -24,6 +24,7 @@
 
 #include <climits>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 #if defined(__GNUC__) && (__GNUC__ <= 5)
@@ -114,6 +115,63 @@ static inline Q8_8 mulaw(Q0_16 a, Q8_8 w) { return static_cast<Q8_8>((a * w) >>
 static inline float mulas(float a, float s) { return a * s; }
 static inline float mulaw(float a, float w) { return a * w; }
 
+//----------------------------------------------------------------------
+//
+// FP16 and BF16 <-> FP32 conversions, round to nearest even
+//
+//----------------------------------------------------------------------
+
+static inline uint32_t as_uint(float f)    { uint32_t u; std::memcpy(&u, &f, sizeof(u)); return u; }
+static inline float    as_float(uint32_t u) { float f;    std::memcpy(&f, &u, sizeof(f)); return f; }
+
+static inline float fp16_to_float(uint16_t h) {
+    constexpr uint32_t shifted_exp = 0x7c00u << 13;  // exponent mask after shift
+    uint32_t o = (h & 0x7fffu) << 13;                // exponent/mantissa bits
+    const uint32_t exp = shifted_exp & o;
+    o += (127 - 15) << 23;                           // exponent adjust
+
+    if (exp == shifted_exp) {                        // Inf/NaN
+        o += (128 - 16) << 23;
+    } else if (exp == 0) {                           // zero/denormal: renormalize
+        o = as_uint(as_float(o + (1u << 23)) - as_float(113u << 23));
+    }
+    return as_float(o | (static_cast<uint32_t>(h & 0x8000u) << 16));
+}
+
+static inline uint16_t float_to_fp16(float x) {
+    constexpr uint32_t f16max       = (127 + 16) << 23;
+    constexpr uint32_t denorm_magic = ((127 - 15) + (23 - 10) + 1) << 23;
+    constexpr uint32_t min_normal   = 113u << 23;
+
+    uint32_t f = as_uint(x);
+    const uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+
+    uint32_t o;
+    if (f >= f16max) {                               // overflow, Inf or NaN
+        o = (f > 0x7f800000u) ? 0x7e00u : 0x7c00u;
+    } else if (f < min_normal) {                     // denormal or zero
+        o = as_uint(as_float(f) + as_float(denorm_magic)) - denorm_magic;
+    } else {
+        const uint32_t mant_odd = (f >> 13) & 1u;
+        f += 0xc8000fffu + mant_odd;                 // rebias exponent, round to nearest even
+        o = f >> 13;
+    }
+    return static_cast<uint16_t>(o | (sign >> 16));
+}
+
+static inline float bf16_to_float(uint16_t h) {
+    return as_float(static_cast<uint32_t>(h) << 16);
+}
+
+static inline uint16_t float_to_bf16(float x) {
+    const uint32_t u = as_uint(x);
+    if ((u & 0x7fffffffu) > 0x7f800000u) {           // NaN: keep it quiet
+        return static_cast<uint16_t>((u >> 16) | 0x0040u);
+    }
+    return static_cast<uint16_t>((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -787,6 +787,154 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+// FP16/BF16 <-> FP32 conversions of a row, see scalar versions in ie_preprocess_gapi_kernels_impl.hpp
+#if MANUAL_SIMD
+static inline v_float32 v_fp16_to_float(const v_uint32& h) {
+    const v_uint32 shifted_exp = vx_setall_u32(0x7c00u << 13);
+    const v_uint32 exp_adjust  = vx_setall_u32((127 - 15) << 23);
+
+    v_uint32 o = (h & vx_setall_u32(0x7fffu)) << 13;
+    const v_uint32 exp = o & shifted_exp;
+    o = o + exp_adjust;
+    o = o + (v_reinterpret_as_u32(v_reinterpret_as_s32(exp) == v_reinterpret_as_s32(shifted_exp)) & exp_adjust);
+
+    const v_float32 denorm = v_reinterpret_as_f32(o + vx_setall_u32(1u << 23)) -
+                             v_reinterpret_as_f32(vx_setall_u32(113u << 23));
+    const v_uint32 is_denorm = v_reinterpret_as_u32(v_reinterpret_as_s32(exp) == vx_setall_s32(0));
+    o = v_select(is_denorm, v_reinterpret_as_u32(denorm), o);
+
+    return v_reinterpret_as_f32(o | ((h & vx_setall_u32(0x8000u)) << 16));
+}
+
+static inline v_uint32 v_float_to_fp16(const v_float32& x) {
+    const v_uint32 denorm_magic = vx_setall_u32(((127 - 15) + (23 - 10) + 1) << 23);
+
+    v_uint32 f = v_reinterpret_as_u32(x);
+    const v_uint32 sign = f & vx_setall_u32(0x80000000u);
+    f = f ^ sign;
+
+    // the sign is cleared, so signed comparisons are safe here
+    const v_int32 fi = v_reinterpret_as_s32(f);
+    const v_uint32 is_big    = v_reinterpret_as_u32(fi >= vx_setall_s32((127 + 16) << 23));
+    const v_uint32 is_nan    = v_reinterpret_as_u32(fi >  vx_setall_s32(0x7f800000));
+    const v_uint32 is_denorm = v_reinterpret_as_u32(fi <  vx_setall_s32(113 << 23));
+
+    const v_uint32 inf_nan = v_select(is_nan, vx_setall_u32(0x7e00u), vx_setall_u32(0x7c00u));
+    const v_uint32 denorm  = v_reinterpret_as_u32(v_reinterpret_as_f32(f) + v_reinterpret_as_f32(denorm_magic)) -
+                             denorm_magic;
+    const v_uint32 mant_odd = (f >> 13) & vx_setall_u32(1u);
+    const v_uint32 normal   = (f + vx_setall_u32(0xc8000fffu) + mant_odd) >> 13;
+
+    v_uint32 o = v_select(is_denorm, denorm, normal);
+    o = v_select(is_big, inf_nan, o);
+    return o | (sign >> 16);
+}
+
+static inline v_uint32 v_float_to_bf16(const v_float32& x) {
+    const v_uint32 u = v_reinterpret_as_u32(x);
+    const v_uint32 is_nan = v_reinterpret_as_u32(v_reinterpret_as_s32(u & vx_setall_u32(0x7fffffffu)) >
+                                                 vx_setall_s32(0x7f800000));
+    const v_uint32 rounded = (u + vx_setall_u32(0x7fffu) + ((u >> 16) & vx_setall_u32(1u))) >> 16;
+    return v_select(is_nan, (u >> 16) | vx_setall_u32(0x0040u), rounded);
+}
+#endif  // MANUAL_SIMD
+
+inline void convertRow_FP16ToF32_impl(const uint16_t in[], float out[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    if (length >= nlanes) {
+        cycle:
+        for (; l <= length - nlanes; l += nlanes) {
+            v_store(&out[l], v_fp16_to_float(vx_load_expand(&in[l])));
+        }
+
+        if (l < length) {
+            l = length - nlanes;
+            goto cycle;
+        }
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = fp16_to_float(in[l]);
+    }
+}
+
+inline void convertRow_F32ToFP16_impl(const float in[], uint16_t out[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    if (length >= nlanes) {
+        cycle:
+        for (; l <= length - nlanes; l += nlanes) {
+            v_pack_store(&out[l], v_float_to_fp16(vx_load(&in[l])));
+        }
+
+        if (l < length) {
+            l = length - nlanes;
+            goto cycle;
+        }
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = float_to_fp16(in[l]);
+    }
+}
+
+inline void convertRow_BF16ToF32_impl(const uint16_t in[], float out[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    if (length >= nlanes) {
+        cycle:
+        for (; l <= length - nlanes; l += nlanes) {
+            v_store(&out[l], v_reinterpret_as_f32(vx_load_expand(&in[l]) << 16));
+        }
+
+        if (l < length) {
+            l = length - nlanes;
+            goto cycle;
+        }
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = bf16_to_float(in[l]);
+    }
+}
+
+inline void convertRow_F32ToBF16_impl(const float in[], uint16_t out[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    if (length >= nlanes) {
+        cycle:
+        for (; l <= length - nlanes; l += nlanes) {
+            v_pack_store(&out[l], v_float_to_bf16(vx_load(&in[l])));
+        }
+
+        if (l < length) {
+            l = length - nlanes;
+            goto cycle;
+        }
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = float_to_bf16(in[l]);
+    }
+}
+
 // Resize (bi-linear, 32FC1)
 static inline void calcRowLinear_32FC1(float *dst[],
                                        const float *src0[],
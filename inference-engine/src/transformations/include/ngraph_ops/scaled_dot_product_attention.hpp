@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace op {
+namespace internal {
+
+/**
+ * @brief Fused softmax(scale * query x key^T + mask) x value
+ * query is [..., L_q, D], key is [..., L_k, D] (or [..., D, L_k] if transpose_key is false),
+ * value is [..., L_k, D_v] and the optional mask is numpy broadcastable to [..., L_q, L_k].
+ * Batch dimensions of query, key and value must be equal, the output is [..., L_q, D_v].
+ */
+class TRANSFORMATIONS_API ScaledDotProductAttention : public Op {
+public:
+    static constexpr NodeTypeInfo type_info{"ScaledDotProductAttention", 0};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    ScaledDotProductAttention(const Output<Node>& query,
+                              const Output<Node>& key,
+                              const Output<Node>& value,
+                              float scale,
+                              bool transpose_key);
+
+    ScaledDotProductAttention(const Output<Node>& query,
+                              const Output<Node>& key,
+                              const Output<Node>& value,
+                              const Output<Node>& mask,
+                              float scale,
+                              bool transpose_key);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_key() const { return m_transpose_key; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_key = true;
+};
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ngraph
@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API ScaledDotProductAttentionFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ScaledDotProductAttentionFusion transformation replaces following graph:
+ * MatMul(query, key)->[Multiply(scale)]->[Add(mask)]->Softmax->MatMul(value) to ScaledDotProductAttention
+ * Restrictions:
+ * - query, key and value have static shapes of the same rank and equal batch dimensions
+ * - scale is a scalar constant, mask doesn't broadcast the attention scores
+ * - Softmax is applied to the last axis, intermediate results have no other consumers
+ */
+
+class ngraph::pass::ScaledDotProductAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledDotProductAttentionFusion();
+};
@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include "ngraph_ops/scaled_dot_product_attention.hpp"
+#include "itt.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::internal::ScaledDotProductAttention::type_info;
+
+op::internal::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& query,
+                                                                   const Output<Node>& key,
+                                                                   const Output<Node>& value,
+                                                                   float scale,
+                                                                   bool transpose_key)
+        : Op({query, key, value}), m_scale(scale), m_transpose_key(transpose_key) {
+    constructor_validate_and_infer_types();
+}
+
+op::internal::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& query,
+                                                                   const Output<Node>& key,
+                                                                   const Output<Node>& value,
+                                                                   const Output<Node>& mask,
+                                                                   float scale,
+                                                                   bool transpose_key)
+        : Op({query, key, value, mask}), m_scale(scale), m_transpose_key(transpose_key) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> op::internal::ScaledDotProductAttention::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(internal_ScaledDotProductAttention_clone_with_new_inputs);
+    if (new_args.size() == 4) {
+        return make_shared<ScaledDotProductAttention>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                      m_scale, m_transpose_key);
+    } else if (new_args.size() == 3) {
+        return make_shared<ScaledDotProductAttention>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                      m_scale, m_transpose_key);
+    }
+    throw ngraph::ngraph_error("Unsupported number of inputs: " + std::to_string(new_args.size()));
+}
+
+bool op::internal::ScaledDotProductAttention::visit_attributes(AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(internal_ScaledDotProductAttention_visit_attributes);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_key", m_transpose_key);
+    return true;
+}
+
+void op::internal::ScaledDotProductAttention::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(internal_ScaledDotProductAttention_validate_and_infer_types);
+    const auto& query_ps = get_input_partial_shape(0);
+    const auto& key_ps = get_input_partial_shape(1);
+    const auto& value_ps = get_input_partial_shape(2);
+
+    PartialShape out_shape = PartialShape::dynamic();
+    if (query_ps.rank().is_static() && key_ps.rank().is_static() && value_ps.rank().is_static()) {
+        const auto rank = query_ps.rank().get_length();
+        NODE_VALIDATION_CHECK(this, rank >= 2 && key_ps.rank().get_length() == rank && value_ps.rank().get_length() == rank,
+                              "Query, key and value must have the same rank not less than 2");
+
+        const auto head_size = m_transpose_key ? key_ps[rank - 1] : key_ps[rank - 2];
+        const auto key_length = m_transpose_key ? key_ps[rank - 2] : key_ps[rank - 1];
+        NODE_VALIDATION_CHECK(this, query_ps[rank - 1].compatible(head_size),
+                              "Query and key have different head sizes");
+        NODE_VALIDATION_CHECK(this, value_ps[rank - 2].compatible(key_length),
+                              "Key and value have different sequence lengths");
+
+        out_shape = query_ps;
+        out_shape[rank - 1] = value_ps[rank - 1];
+    }
+
+    set_output_type(0, get_input_element_type(0), out_shape);
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp"
+#include "ngraph_ops/scaled_dot_product_attention.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include "itt.hpp"
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ScaledDotProductAttentionFusion, "ScaledDotProductAttentionFusion", 0);
+
+namespace {
+bool has_single_consumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+}  // namespace
+
+ngraph::pass::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    MATCHER_SCOPE(ScaledDotProductAttentionFusion);
+    auto softmax_pattern = ngraph::pattern::wrap_type<opset1::Softmax>(pattern::consumers_count(1));
+    auto value_pattern = ngraph::pattern::any_input();
+    auto matmul_pattern = ngraph::pattern::wrap_type<opset1::MatMul>({softmax_pattern, value_pattern});
+
+    ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_value_map();
+        auto matmul = std::dynamic_pointer_cast<opset1::MatMul>(pattern_map.at(matmul_pattern).get_node_shared_ptr());
+        auto softmax = std::dynamic_pointer_cast<opset1::Softmax>(pattern_map.at(softmax_pattern).get_node_shared_ptr());
+        if (!matmul || !softmax || matmul->get_transpose_a() || matmul->get_transpose_b() || transformation_callback(matmul))
+            return false;
+
+        const auto& scores_ps = softmax->get_output_partial_shape(0);
+        if (scores_ps.is_dynamic() || softmax->get_axis() + 1 != static_cast<size_t>(scores_ps.rank().get_length()))
+            return false;
+        const auto scores_shape = scores_ps.to_shape();
+
+        NodeVector fused_nodes{matmul, softmax};
+        auto scores = softmax->input_value(0);
+
+        Output<Node> mask;
+        if (auto add = std::dynamic_pointer_cast<opset1::Add>(scores.get_node_shared_ptr())) {
+            if (!has_single_consumer(scores) || add->get_autob().m_type == op::AutoBroadcastType::PDPD)
+                return false;
+            // the mask is broadcasted to the attention scores computed by the other input
+            auto is_scores = [&](size_t idx) {
+                const auto producer = add->get_input_node_ptr(idx);
+                return add->get_input_partial_shape(idx) == scores_ps &&
+                       (ngraph::is_type<opset1::MatMul>(producer) || ngraph::is_type<opset1::Multiply>(producer));
+            };
+            const size_t scores_idx = is_scores(0) ? 0 : 1;
+            if (!is_scores(scores_idx))
+                return false;
+            scores = add->input_value(scores_idx);
+            mask = add->input_value(1 - scores_idx);
+            fused_nodes.push_back(add);
+        }
+
+        float scale = 1.f;
+        if (auto multiply = std::dynamic_pointer_cast<opset1::Multiply>(scores.get_node_shared_ptr())) {
+            if (!has_single_consumer(scores))
+                return false;
+            size_t const_idx = 1;
+            auto scale_const = std::dynamic_pointer_cast<opset1::Constant>(multiply->get_input_node_shared_ptr(const_idx));
+            if (!scale_const) {
+                const_idx = 0;
+                scale_const = std::dynamic_pointer_cast<opset1::Constant>(multiply->get_input_node_shared_ptr(const_idx));
+            }
+            if (!scale_const || shape_size(scale_const->get_shape()) != 1)
+                return false;
+            scale = scale_const->cast_vector<float>()[0];
+            scores = multiply->input_value(1 - const_idx);
+            fused_nodes.push_back(multiply);
+        }
+
+        auto qk = std::dynamic_pointer_cast<opset1::MatMul>(scores.get_node_shared_ptr());
+        if (!qk || qk->get_transpose_a() || !has_single_consumer(scores) ||
+            qk->get_output_partial_shape(0) != scores_ps)
+            return false;
+        fused_nodes.push_back(qk);
+
+        auto query = qk->input_value(0);
+        auto key = qk->input_value(1);
+        auto value = pattern_map.at(value_pattern);
+        if (query.get_partial_shape().is_dynamic() || key.get_partial_shape().is_dynamic() || value.get_partial_shape().is_dynamic())
+            return false;
+
+        // MatMul broadcasting of the batch dimensions isn't supported by the fused operation
+        const auto rank = scores_shape.size();
+        const auto query_shape = query.get_shape();
+        const auto key_shape = key.get_shape();
+        const auto value_shape = value.get_shape();
+        if (rank < 2 || query_shape.size() != rank || key_shape.size() != rank || value_shape.size() != rank)
+            return false;
+        for (size_t i = 0; i + 2 < rank; i++) {
+            if (query_shape[i] != key_shape[i] || query_shape[i] != value_shape[i])
+                return false;
+        }
+
+        std::shared_ptr<Node> attention;
+        if (mask.get_node()) {
+            const auto& mask_ps = mask.get_partial_shape();
+            if (mask_ps.is_dynamic() || mask_ps.rank().get_length() > static_cast<int64_t>(rank))
+                return false;
+            attention = std::make_shared<op::internal::ScaledDotProductAttention>(query, key, value, mask, scale, qk->get_transpose_b());
+        } else {
+            attention = std::make_shared<op::internal::ScaledDotProductAttention>(query, key, value, scale, qk->get_transpose_b());
+        }
+
+        attention->set_friendly_name(matmul->get_friendly_name());
+        copy_runtime_info(fused_nodes, attention);
+        replace_node(matmul, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_pattern, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -211,3 +211,39 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+TEST(CPUStreamsExecutorTests, tasksAreDispatchedByPriorityThenByDeadline) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    std::promise<void> blocker;
+    auto blocked = blocker.get_future().share();
+    std::mutex mutex;
+    std::vector<int> order;
+    auto now = std::chrono::steady_clock::now();
+    auto noDeadline = std::chrono::steady_clock::time_point::max();
+    auto makeTask = [&] (int id) {
+        return [&, id] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(id);
+        };
+    };
+
+    // occupy the only stream so the following tasks are queued
+    std::promise<void> started;
+    auto first = async(executor, [blocked, &started] {
+        started.set_value();
+        blocked.wait();
+    });
+    started.get_future().wait();
+    executor->run(makeTask(0), IStreamsExecutor::Priority::LOW, noDeadline);
+    executor->run(makeTask(1), IStreamsExecutor::Priority::MEDIUM, noDeadline);
+    executor->run(makeTask(2), IStreamsExecutor::Priority::HIGH, noDeadline);
+    executor->run(makeTask(3), IStreamsExecutor::Priority::HIGH, now + std::chrono::seconds(1));
+    executor->run(makeTask(4), IStreamsExecutor::Priority::MEDIUM, noDeadline);
+    std::promise<void> done;
+    executor->run([&done] { done.set_value(); }, IStreamsExecutor::Priority::LOW, noDeadline);
+    blocker.set_value();
+    first.wait();
+    done.get_future().wait();
+
+    std::lock_guard<std::mutex> lock{mutex};
+    ASSERT_EQ((std::vector<int>{3, 2, 1, 4, 0}), order);
+}
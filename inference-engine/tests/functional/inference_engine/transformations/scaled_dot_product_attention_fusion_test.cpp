@@ -0,0 +1,116 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/scaled_dot_product_attention_fusion.hpp>
+#include <ngraph_ops/scaled_dot_product_attention.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, ScaledDotProductAttentionFusion) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 12, 128, 64});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 12, 128, 64});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 12, 128, 64});
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 1, 128});
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.125});
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(qk, scale);
+        auto add = std::make_shared<ngraph::opset1::Add>(mul, mask);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(add, 3);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{query, key, value, mask});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 12, 128, 64});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 12, 128, 64});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 12, 128, 64});
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 1, 128});
+        auto attention = std::make_shared<ngraph::op::internal::ScaledDotProductAttention>(query, key, value, mask, 0.125f, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value, mask});
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWithoutScaleAndMask) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 16, 32});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 32, 24});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 24, 8});
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 2);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{query, key, value});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 16, 32});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 32, 24});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{4, 24, 8});
+        auto attention = std::make_shared<ngraph::op::internal::ScaledDotProductAttention>(query, key, value, 1.f, false);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{query, key, value});
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionNegativeSoftmaxAxis) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto build = [] {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 16, 16});
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 16, 16});
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 16, 16});
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 1);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{query, key, value});
+    };
+    {
+        f = build();
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::ScaledDotProductAttentionFusion>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    f_ref = build();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -220,8 +220,8 @@ opset_import {
 }
 
 
-TEST(Extension, XmlModelWithCustomAbs) {
-    std::string model = R"V0G0N(
+static std::string custom_abs_xml_model() {
+    return R"V0G0N(
 <net name="Network" version="10">
     <layers>
         <layer name="in1" type="Parameter" id="0" version="opset1">
@@ -258,6 +258,10 @@ TEST(Extension, XmlModelWithCustomAbs) {
     </edges>
 </net>
 )V0G0N";
+}
+
+TEST(Extension, XmlModelWithCustomAbs) {
+    std::string model = custom_abs_xml_model();
 
     std::vector<float> input_values{1, -2, 3, -4, 5, -6, 7, -8, 9, -10};
     std::vector<float> expected{1, 4, 3, 8, 5, 12, 7, 16, 9, 20};
@@ -266,6 +270,67 @@ TEST(Extension, XmlModelWithCustomAbs) {
     infer_model(ie, model, input_values, expected);
 }
 
+// The node keeps blobs over the edges memory between inferences, they have to follow user blobs set to the request
+TEST(Extension, XmlModelWithCustomAbsAfterInputsAndOutputsChange) {
+    InferenceEngine::Core ie;
+    ie.AddExtension(std::make_shared<CustomAbsExtension>());
+    InferenceEngine::Blob::CPtr weights;
+    auto network = ie.ReadNetwork(custom_abs_xml_model(), weights);
+    const auto input_name = network.getInputsInfo().begin()->first;
+    const auto output = network.getOutputsInfo().begin();
+    auto exe_network = ie.LoadNetwork(network, "CPU");
+    auto inference_req = exe_network.CreateInferRequest();
+
+    auto make_blob = [](const InferenceEngine::TensorDesc& desc, const std::vector<float>& values) {
+        auto blob = std::make_shared<InferenceEngine::TBlob<float>>(desc);
+        blob->allocate();
+        std::copy(values.begin(), values.end(), blob->wmap().template as<float*>());
+        return blob;
+    };
+    auto values_of = [](const InferenceEngine::Blob::Ptr& blob) {
+        auto mblob = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob);
+        const auto holder = mblob->rmap();
+        const auto* data = holder.template as<const float*>();
+        return std::vector<float>(data, data + mblob->size());
+    };
+
+    const auto& input_desc = network.getInputsInfo().begin()->second->getTensorDesc();
+    const auto& output_desc = output->second->getTensorDesc();
+
+    // data of the request own blobs change in place
+    auto request_input = inference_req.GetBlob(input_name);
+    for (float scale : {1.f, 3.f}) {
+        std::vector<float> values{1, -2, 3, -4, 5, -6, 7, -8, 9, -10};
+        std::vector<float> expected{1, 4, 3, 8, 5, 12, 7, 16, 9, 20};
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i] *= scale;
+            expected[i] *= scale;
+        }
+        {
+            auto input_data = InferenceEngine::as<InferenceEngine::MemoryBlob>(request_input)->wmap();
+            std::copy(values.begin(), values.end(), input_data.template as<float*>());
+        }
+        inference_req.Infer();
+        ASSERT_EQ(expected, values_of(inference_req.GetBlob(output->first)));
+    }
+
+    // user blobs are set instead, then replaced by other ones
+    auto first_input = make_blob(input_desc, {-1, -1, -1, -1, -1, 2, 2, 2, 2, 2});
+    auto first_output = make_blob(output_desc, std::vector<float>(10, 0));
+    inference_req.SetBlob(input_name, first_input);
+    inference_req.SetBlob(output->first, first_output);
+    inference_req.Infer();
+    ASSERT_EQ((std::vector<float>{2, 2, 2, 2, 2, 2, 2, 2, 2, 2}), values_of(first_output));
+
+    auto second_input = make_blob(input_desc, {5, 5, 5, 5, 5, -3, -3, -3, -3, -3});
+    auto second_output = make_blob(output_desc, std::vector<float>(10, 0));
+    inference_req.SetBlob(input_name, second_input);
+    inference_req.SetBlob(output->first, second_output);
+    inference_req.Infer();
+    ASSERT_EQ((std::vector<float>{5, 5, 5, 5, 5, 6, 6, 6, 6, 6}), values_of(second_output));
+    ASSERT_EQ((std::vector<float>{2, 2, 2, 2, 2, 2, 2, 2, 2, 2}), values_of(first_output));
+}
+
 
 static std::string get_extension_path() {
     return FileUtils::makePluginLibraryName<char>({}, std::string("template_extension") + IE_BUILD_POSTFIX);
@@ -148,6 +148,33 @@ TEST(IEClassBasicTest, smoke_SetConfigAfterCreatedThrow) {
     ASSERT_EQ("4", value);
 }
 
+TEST(IEClassBasicTest, smoke_ExecNetworkSetModelPriorityAfterLoad) {
+    Core ie;
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleConv());
+    ExecutableNetwork exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = ie.LoadNetwork(network, "CPU", {{KEY_MODEL_PRIORITY, MODEL_PRIORITY_LOW}}));
+    ASSERT_EQ(MODEL_PRIORITY_LOW, exeNetwork.GetConfig(KEY_MODEL_PRIORITY).as<std::string>());
+
+    ASSERT_NO_THROW(exeNetwork.SetConfig({{KEY_MODEL_PRIORITY, MODEL_PRIORITY_HIGH}, {KEY_MODEL_DEADLINE, "10"}}));
+    ASSERT_EQ(MODEL_PRIORITY_HIGH, exeNetwork.GetConfig(KEY_MODEL_PRIORITY).as<std::string>());
+    ASSERT_EQ("10", exeNetwork.GetConfig(KEY_MODEL_DEADLINE).as<std::string>());
+
+    auto request = exeNetwork.CreateInferRequest();
+    ASSERT_NO_THROW(request.StartAsync());
+    ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST(IEClassBasicTest, smoke_ExecNetworkSetModelPriorityWithoutPriorityAtLoadThrows) {
+    Core ie;
+    CNNNetwork network(ngraph::builder::subgraph::makeSingleConv());
+    ExecutableNetwork exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = ie.LoadNetwork(network, "CPU"));
+
+    ASSERT_THROW(exeNetwork.SetConfig({{KEY_MODEL_PRIORITY, MODEL_PRIORITY_HIGH}}), InferenceEngineException);
+    ASSERT_THROW(exeNetwork.SetConfig({{KEY_MODEL_DEADLINE, "10"}}), InferenceEngineException);
+    ASSERT_EQ(MODEL_PRIORITY_MED, exeNetwork.GetConfig(KEY_MODEL_PRIORITY).as<std::string>());
+}
+
 // IE Class Query network
 
 INSTANTIATE_TEST_CASE_P(
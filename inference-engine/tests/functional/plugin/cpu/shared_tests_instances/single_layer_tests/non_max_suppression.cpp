@@ -40,3 +40,25 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 );
 
 INSTANTIATE_TEST_CASE_P(smoke_NmsLayerTest, NmsLayerTest, nmsParams, NmsLayerTest::getTestCaseName);
+
+// long lists of boxes per class are suppressed by vectorized kernels and split across threads
+const std::vector<InputShapeParams> largeInShapeParams = {
+    InputShapeParams{1, 10000, 1},
+    InputShapeParams{2, 2000, 3}
+};
+
+const auto largeNmsParams = ::testing::Combine(::testing::ValuesIn(largeInShapeParams),
+                                               ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                  ::testing::Values(Precision::I32),
+                                                                  ::testing::Values(Precision::FP32)),
+                                               ::testing::Values(200),
+                                               ::testing::ValuesIn(threshold),
+                                               ::testing::Values(0.3f),
+                                               ::testing::Values(0.0f),
+                                               ::testing::ValuesIn(encodType),
+                                               ::testing::Values(true),
+                                               ::testing::Values(element::i32),
+                                               ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_NmsLayerTest_LargeBoxes, NmsLayerTest, largeNmsParams, NmsLayerTest::getTestCaseName);
@@ -52,4 +52,19 @@ INSTANTIATE_TEST_CASE_P(smoke_TopK, TopKLayerTest,
                 ::testing::Values(std::vector<size_t>({10, 10, 10})),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         TopKLayerTest::getTestCaseName);
+
+// the reduction axis of a few long rows is split across threads
+INSTANTIATE_TEST_CASE_P(smoke_TopK_LongAxis, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::Values(1, 10, 100),
+                ::testing::Values(1),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::FP32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::Values(std::vector<size_t>({2, 100000})),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
 }  // namespace
@@ -32,10 +32,6 @@ std::vector<std::string> disabledTestPatterns() {
         R"(.*(CoreThreadingTestsWithIterations).*(smoke_LoadNetworkAccuracy).*)",
 #endif
         // TODO: Issue: 43793
-        R"(.*(PreprocessTest).*(SetScalePreProcessSetBlob).*)",
-        R"(.*(PreprocessTest).*(SetScalePreProcessGetBlob).*)",
-        R"(.*(PreprocessTest).*(SetMeanValuePreProcessSetBlob).*)",
-        R"(.*(PreprocessTest).*(SetMeanImagePreProcessSetBlob).*)",
         R"(.*(PreprocessTest).*(ReverseInputChannelsPreProcessGetBlob).*)",
         // TODO: Issue: 34348
         R"(.*IEClassGetAvailableDevices.*)",
@@ -0,0 +1,146 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+
+using DetailedPerfCountParams = std::tuple<
+        std::vector<size_t>,    // input shape
+        size_t>;                // number of output channels
+
+/**
+ * Convolution with fused Relu is inferred several times with the detailed profiling on.
+ * The report written on destruction of the executable network is checked against the shapes of the convolution.
+ */
+class DetailedPerfCountTest : public testing::WithParamInterface<DetailedPerfCountParams>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DetailedPerfCountParams> &obj) {
+        std::vector<size_t> inputShape;
+        size_t outChannels;
+        std::tie(inputShape, outChannels) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outChannels;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::tie(inputShape, outChannels) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        reportPath = "detailed_perf_count.json";
+        configuration[PluginConfigInternalParams::KEY_DETAILED_PERF_COUNT] = reportPath;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {kernel, kernel}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, outChannels);
+        auto relu = ngraph::builder::makeActivation(conv, ngraph::element::f32, ngraph::helpers::Relu);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "DetailedPerfCount");
+    }
+
+    void TearDown() override {
+        std::remove(reportPath.c_str());
+    }
+
+    // Numeric field of a single line JSON object
+    static double getField(const std::string &line, const std::string &key) {
+        auto pos = line.find("\"" + key + "\": ");
+        EXPECT_NE(std::string::npos, pos) << "No field " << key << " in " << line;
+        return pos == std::string::npos ? 0.0 : std::stod(line.substr(pos + key.size() + 4));
+    }
+
+    std::vector<size_t> inputShape;
+    size_t outChannels;
+    const size_t kernel = 3;
+    std::string reportPath;
+};
+
+TEST_P(DetailedPerfCountTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const size_t inferCount = 5;
+    for (size_t i = 1; i < inferCount; i++)
+        inferRequest.Infer();
+
+    // the report is written when the executable network is destroyed
+    inferRequest = {};
+    executableNetwork = {};
+
+    std::ifstream report(reportPath);
+    ASSERT_TRUE(report.is_open()) << "Detailed perf report " << reportPath << " is not written";
+    std::string json((std::istreambuf_iterator<char>(report)), std::istreambuf_iterator<char>());
+    ASSERT_NE(std::string::npos, json.find("\"traceEvents\": [")) << json;
+    ASSERT_NE(std::string::npos, json.find("\"nodes\": [")) << json;
+
+    size_t events = 0, count = 0;
+    std::istringstream lines(json);
+    for (std::string line; std::getline(lines, line);) {
+        if (line.find("\"ph\": \"X\"") != std::string::npos) {
+            if (line.find("\"cat\": \"Convolution\"") != std::string::npos)
+                events++;
+            ASSERT_GE(getField(line, "dur"), 0.0);
+            continue;
+        }
+        if (line.find("{\"stream\": ") != 0 || line.find("\"type\": \"Convolution\"") == std::string::npos)
+            continue;
+
+        count += static_cast<size_t>(getField(line, "count"));
+
+        double minUs = getField(line, "min_us");
+        double maxUs = getField(line, "max_us");
+        for (auto key : {"avg_us", "p50_us", "p90_us", "p99_us"}) {
+            ASSERT_LE(minUs, getField(line, key)) << key;
+            ASSERT_GE(maxUs, getField(line, key)) << key;
+        }
+
+        const size_t inElems = ngraph::shape_size(inputShape);
+        const size_t outElems = inElems / inputShape[1] * outChannels;
+        const size_t weightsElems = outChannels * inputShape[1] * kernel * kernel;
+        ASSERT_GE(getField(line, "bytes_read"), static_cast<double>((inElems + weightsElems) * sizeof(float)));
+        ASSERT_EQ(outElems * sizeof(float), static_cast<size_t>(getField(line, "bytes_written")));
+        // multiply-add of every weight per output element, the fused Relu is one operation per output element
+        double flops = getField(line, "flops");
+        ASSERT_GE(flops, 2.0 * outElems * weightsElems / outChannels);
+        ASSERT_LE(flops, 2.0 * outElems * weightsElems / outChannels + outElems);
+        ASSERT_GT(getField(line, "gflops"), 0.0);
+        ASSERT_GT(getField(line, "gbps"), 0.0);
+    }
+    ASSERT_EQ(inferCount, count);
+    ASSERT_EQ(inferCount, events);
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 3, 10, 7},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_DetailedPerfCount, DetailedPerfCountTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(4, 16)),
+                        DetailedPerfCountTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
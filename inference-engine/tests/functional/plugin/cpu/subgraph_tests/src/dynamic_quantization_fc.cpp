@@ -0,0 +1,107 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "exec_graph_info.hpp"
+#include "ie_system_conf.h"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+
+using DynamicQuantizationFCParams = std::tuple<
+        std::vector<size_t>,    // input shape
+        size_t,                 // number of output channels
+        std::string>;           // dynamic quantization mode
+
+class DynamicQuantizationFCTest : public testing::WithParamInterface<DynamicQuantizationFCParams>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicQuantizationFCParams> &obj) {
+        std::vector<size_t> inputShape;
+        size_t outputChannels;
+        std::string mode;
+        std::tie(inputShape, outputChannels, mode) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels << "_";
+        result << "mode=" << mode;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inputShape;
+        size_t outputChannels;
+        std::string mode;
+        std::tie(inputShape, outputChannels, mode) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_DYNAMIC_QUANTIZATION] = mode;
+        configuration[PluginConfigParams::KEY_ENFORCE_BF16] = PluginConfigParams::NO;
+        // activations and weights lose precision in 8 bits
+        threshold = 0.05f;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto weights = ngraph::builder::makeConstant<float>(ngraph::element::f32, {outputChannels, inputShape.back()}, {}, true);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(params[0], weights, false, true);
+        auto biases = ngraph::builder::makeConstant<float>(ngraph::element::f32, {outputChannels}, {}, true);
+        auto add = std::make_shared<ngraph::opset1::Add>(matMul, biases);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, params, "DynamicQuantizationFC");
+    }
+
+    void CheckQuantizedExecution() {
+        CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        for (const auto &node : execFunction->get_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string &paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "FullyConnected") {
+                ASSERT_EQ("U8", getExecValue(ExecGraphInfoSerialization::RUNTIME_PRECISION));
+            }
+        }
+    }
+};
+
+TEST_P(DynamicQuantizationFCTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    if (with_cpu_x86_avx512_core())
+        CheckQuantizedExecution();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 64},
+        {7, 256},
+        {2, 24, 768},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_DynamicQuantizationFC, DynamicQuantizationFCTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(16, 129),
+                                ::testing::Values(PluginConfigInternalParams::PER_TENSOR, PluginConfigInternalParams::PER_ROW)),
+                        DynamicQuantizationFCTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+
+using InterOpParallelBranchesParams = std::tuple<
+        std::vector<size_t>,    // input shape
+        size_t>;                // number of branches
+
+class InterOpParallelBranchesTest : public testing::WithParamInterface<InterOpParallelBranchesParams>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterOpParallelBranchesParams> &obj) {
+        std::vector<size_t> inputShape;
+        size_t branchesNum;
+        std::tie(inputShape, branchesNum) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "branches=" << branchesNum;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inputShape;
+        size_t branchesNum;
+        std::tie(inputShape, branchesNum) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_INTER_OP_PARALLELISM] = PluginConfigParams::YES;
+
+        // Branches of different depth, so the levels of the graph contain nodes from several branches
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        ngraph::OutputVector branches;
+        for (size_t i = 0; i < branchesNum; i++) {
+            std::shared_ptr<ngraph::Node> branch = params[0];
+            for (size_t j = 0; j <= i; j++) {
+                branch = ngraph::builder::makeConvolution(branch, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                          ngraph::op::PadType::EXPLICIT, inputShape[1], true);
+                branch = ngraph::builder::makeActivation(branch, ngraph::element::f32, ngraph::helpers::Relu);
+            }
+            branches.push_back(branch);
+        }
+        auto concat = std::make_shared<ngraph::opset1::Concat>(branches, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, params, "InterOpParallelBranches");
+    }
+};
+
+TEST_P(InterOpParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 16, 7, 9},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_InterOpParallelBranches, InterOpParallelBranchesTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(2, 4)),
+                        InterOpParallelBranchesTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace LayerTestsDefinitions {
+
+using ScaledDotProductAttentionParams = std::tuple<
+        std::vector<size_t>,    // query, key and value shape [batch, heads, sequence, head size]
+        bool,                   // transpose key in the first MatMul
+        bool>;                  // add mask
+
+class ScaledDotProductAttentionTest : public testing::WithParamInterface<ScaledDotProductAttentionParams>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ScaledDotProductAttentionParams> &obj) {
+        std::vector<size_t> inputShape;
+        bool transposeKey, withMask;
+        std::tie(inputShape, transposeKey, withMask) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "transposeKey=" << transposeKey << "_";
+        result << "withMask=" << withMask;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inputShape;
+        bool transposeKey, withMask;
+        std::tie(inputShape, transposeKey, withMask) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto keyShape = inputShape;
+        if (!transposeKey)
+            std::swap(keyShape[2], keyShape[3]);
+        std::vector<size_t> maskShape{inputShape[0], 1, 1, inputShape[2]};
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, keyShape, inputShape, maskShape});
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(params[0], params[1], false, transposeKey);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{},
+                                                      {1.f / std::sqrt(static_cast<float>(inputShape[3]))});
+        std::shared_ptr<ngraph::Node> scores = std::make_shared<ngraph::opset1::Multiply>(qk, scale);
+        if (withMask) {
+            scores = std::make_shared<ngraph::opset1::Add>(scores, params[3]);
+        } else {
+            params.pop_back();
+        }
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, 3);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(softmax, params[2]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(matmul)};
+        function = std::make_shared<ngraph::Function>(results, params, "ScaledDotProductAttention");
+    }
+};
+
+TEST_P(ScaledDotProductAttentionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "ScaledDotProductAttention", 1);
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 4, 16, 8},
+        {2, 12, 77, 64},
+        {1, 2, 384, 64},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ScaledDotProductAttention, ScaledDotProductAttentionTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(true, false),
+                                ::testing::Values(true, false)),
+                        ScaledDotProductAttentionTest::getTestCaseName);
+
+} // namespace
+} // namespace LayerTestsDefinitions
@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "ie_system_conf.h"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+
+using SnippetsEltwiseParams = std::tuple<
+        std::vector<size_t>,    // first input shape
+        std::vector<size_t>>;   // second input shape, broadcasted to the first one
+
+class SnippetsEltwiseTest : public testing::WithParamInterface<SnippetsEltwiseParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsEltwiseParams> &obj) {
+        std::vector<size_t> firstShape, secondShape;
+        std::tie(firstShape, secondShape) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(firstShape) << "_" << CommonTestUtils::vec2str(secondShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> firstShape, secondShape;
+        std::tie(firstShape, secondShape) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_SNIPPETS_MODE] = PluginConfigParams::YES;
+
+        // Add has two consumers, so it starts a snippet and the rest of the chain is attached to it
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {firstShape, secondShape});
+        auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(add);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.5f});
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(add, scale);
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(sigmoid, mul);
+        auto max = std::make_shared<ngraph::opset1::Maximum>(sub, params[1]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(max)};
+        function = std::make_shared<ngraph::Function>(results, params, "SnippetsEltwise");
+    }
+};
+
+TEST_P(SnippetsEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (with_cpu_x86_avx2())
+        CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+}
+
+namespace {
+
+const std::vector<SnippetsEltwiseParams> sameShapes = {
+        SnippetsEltwiseParams{{1, 3, 16, 20}, {1, 3, 16, 20}},
+        SnippetsEltwiseParams{{2, 17, 5, 67}, {2, 17, 5, 67}},
+        SnippetsEltwiseParams{{3, 1000}, {3, 1000}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEltwise_SameShapes, SnippetsEltwiseTest,
+                        ::testing::ValuesIn(sameShapes),
+                        SnippetsEltwiseTest::getTestCaseName);
+
+const std::vector<std::vector<size_t>> broadcastedShapes = {
+        {1, 3, 1, 1},
+        {1, 1, 1, 20},
+        {1, 3, 16, 1},
+        {20},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEltwise_Broadcast, SnippetsEltwiseTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{1, 3, 16, 20}),
+                                ::testing::ValuesIn(broadcastedShapes)),
+                        SnippetsEltwiseTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
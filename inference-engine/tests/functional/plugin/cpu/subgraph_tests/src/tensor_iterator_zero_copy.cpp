@@ -0,0 +1,136 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph/opsets/opset5.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace LayerTestsDefinitions {
+
+using TensorIteratorZeroCopyParams = std::tuple<
+        bool,       // Loop instead of TensorIterator
+        bool,       // reverse direction of the sequence
+        bool,       // return all iterations of the hidden state, not only the last one
+        size_t>;    // sequence length
+
+/**
+ * RNN-like body H = Tanh(X[i] * W + H * R) which is executed with sliced ports and the back edge
+ * bound to the outer and body memory directly. The network is inferred several times to check that
+ * the bindings are restored between inferences.
+ */
+class TensorIteratorZeroCopyTest : public testing::WithParamInterface<TensorIteratorZeroCopyParams>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorZeroCopyParams> &obj) {
+        bool isLoop, reverse, allIterations;
+        size_t seqLen;
+        std::tie(isLoop, reverse, allIterations, seqLen) = obj.param;
+
+        std::ostringstream result;
+        result << (isLoop ? "Loop" : "TensorIterator") << "_";
+        result << "seqLen=" << seqLen << "_";
+        result << "reverse=" << reverse << "_";
+        result << "allIterations=" << allIterations;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        bool isLoop, reverse, allIterations;
+        size_t seqLen;
+        std::tie(isLoop, reverse, allIterations, seqLen) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t hiddenSize = 16;
+        const int64_t axis = 1;
+        auto outerParams = ngraph::builder::makeParams(ngraph::element::f32, {{1, seqLen, hiddenSize}, {1, 1, hiddenSize}});
+
+        auto bodyParams = ngraph::builder::makeParams(ngraph::element::f32, {{1, 1, hiddenSize}, {1, 1, hiddenSize}});
+        auto W = ngraph::builder::makeConstant<float>(ngraph::element::f32, {hiddenSize, hiddenSize}, makeWeights(hiddenSize, 1));
+        auto R = ngraph::builder::makeConstant<float>(ngraph::element::f32, {hiddenSize, hiddenSize}, makeWeights(hiddenSize, 2));
+        auto xW = std::make_shared<ngraph::opset5::MatMul>(bodyParams[0], W);
+        auto hR = std::make_shared<ngraph::opset5::MatMul>(bodyParams[1], R);
+        auto add = std::make_shared<ngraph::opset5::Add>(xW, hR);
+        auto hidden = std::make_shared<ngraph::opset5::Tanh>(add);
+
+        ngraph::ResultVector bodyResults{std::make_shared<ngraph::opset5::Result>(hidden)};
+        std::shared_ptr<ngraph::op::util::SubGraphOp> subgraph;
+        if (isLoop) {
+            auto tripCount = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, seqLen);
+            auto execCondition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+            auto bodyCondition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+            bodyResults.push_back(std::make_shared<ngraph::opset5::Result>(bodyCondition));
+            auto loop = std::make_shared<ngraph::opset5::Loop>(tripCount, execCondition);
+            loop->set_special_body_ports(ngraph::opset5::Loop::SpecialBodyPorts{-1, 1});
+            subgraph = loop;
+        } else {
+            subgraph = std::make_shared<ngraph::opset5::TensorIterator>();
+        }
+        subgraph->set_function(std::make_shared<ngraph::Function>(bodyResults, bodyParams, "rnn_cell"));
+
+        if (reverse) {
+            subgraph->set_sliced_input(bodyParams[0], outerParams[0], -1, -1, 1, 0, axis);
+        } else {
+            subgraph->set_sliced_input(bodyParams[0], outerParams[0], 0, 1, 1, -1, axis);
+        }
+        subgraph->set_merged_input(bodyParams[1], outerParams[1], bodyResults[0]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset5::Result>(subgraph->get_iter_value(bodyResults[0], -1))};
+        if (allIterations) {
+            auto slices = reverse ? subgraph->get_concatenated_slices(bodyResults[0], -1, -1, 1, 0, axis)
+                                  : subgraph->get_concatenated_slices(bodyResults[0], 0, 1, 1, -1, axis);
+            results.push_back(std::make_shared<ngraph::opset5::Result>(slices));
+        }
+        function = std::make_shared<ngraph::Function>(results, outerParams, "TensorIteratorZeroCopy");
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 16, seed);
+    }
+
+    static std::vector<float> makeWeights(size_t size, size_t seed) {
+        // small weights keep Tanh out of saturation, so every iteration affects the result
+        std::vector<float> weights(size * size);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(static_cast<int>((i * 7 + seed * 13) % 17) - 8) / 32.f;
+        return weights;
+    }
+
+    int seed = 1;
+};
+
+TEST_P(TensorIteratorZeroCopyTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the same request is inferred again with other data after the bindings were restored
+    for (seed = 2; seed < 4; seed++) {
+        inputs.clear();
+        GenerateInputs();
+        const auto &params = function->get_parameters();
+        for (size_t i = 0; i < params.size(); i++)
+            inferRequest.SetBlob(params[i]->get_friendly_name(), inputs[i]);
+        inferRequest.Infer();
+        Validate();
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorZeroCopy, TensorIteratorZeroCopyTest,
+                        ::testing::Combine(
+                                ::testing::Values(false, true),
+                                ::testing::Values(false, true),
+                                ::testing::Values(false, true),
+                                ::testing::Values(1, 5)),
+                        TensorIteratorZeroCopyTest::getTestCaseName);
+
+} // namespace
+} // namespace LayerTestsDefinitions
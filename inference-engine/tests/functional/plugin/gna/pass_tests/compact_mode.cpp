@@ -0,0 +1,138 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <string>
+
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+typedef std::tuple<
+        InferenceEngine::Precision,         // Network Precision
+        std::string,                        // Target Device
+        std::map<std::string, std::string>  // Configuration
+> CompactModeParams;
+
+namespace LayerTestsDefinitions {
+
+/**
+ * Chain of fully connected layers with split, concat and a memory layer, so intermediate buffers
+ * have short lifetimes and share GNA memory in compact mode. Outputs of several inferences
+ * of the same request must not differ from the ones with compact mode off.
+ */
+class CompactModeTest : public testing::WithParamInterface<CompactModeParams>,
+                        public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<CompactModeParams> obj) {
+        InferenceEngine::Precision netPrecision;
+        std::string targetDevice;
+        std::map<std::string, std::string> configuration;
+        std::tie(netPrecision, targetDevice, configuration) = obj.param;
+
+        std::ostringstream result;
+        result << "netPRC=" << netPrecision.name() << "_";
+        result << "targetDevice=" << targetDevice << "_";
+        for (auto const& configItem : configuration) {
+            result << "_configItem=" << configItem.first << "_" << configItem.second;
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        InferenceEngine::Precision netPrecision;
+        std::tie(netPrecision, targetDevice, configuration) = this->GetParam();
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+
+        const size_t size = 32;
+        auto params = ngraph::builder::makeParams(ngPrc, { {1, 2 * size} });
+        auto split = ngraph::builder::makeSplit(params[0], ngPrc, 2, 1);
+
+        auto fc1 = ngraph::builder::makeFullyConnected(split->output(0), ngPrc, size, false, {},
+                                                       CommonTestUtils::generate_float_numbers(size * size, -0.2f, 0.2f, 1));
+        auto relu = ngraph::builder::makeActivation(fc1, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+        auto fc2 = ngraph::builder::makeFullyConnected(relu, ngPrc, size, false, {},
+                                                       CommonTestUtils::generate_float_numbers(size * size, -0.2f, 0.2f, 2));
+        auto tanh = ngraph::builder::makeActivation(fc2, ngPrc, ngraph::helpers::ActivationTypes::Tanh);
+
+        auto memoryInit = ngraph::builder::makeConstant<float>(ngPrc, {1, size}, {0.0f});
+        auto memoryRead = std::make_shared<ngraph::opset5::ReadValue>(memoryInit, "memory");
+        auto add = ngraph::builder::makeEltwise(split->output(1), memoryRead, ngraph::helpers::EltwiseTypes::ADD);
+        auto memoryWrite = std::make_shared<ngraph::opset5::Assign>(add, "memory");
+        memoryWrite->add_control_dependency(memoryRead);
+
+        auto concat = ngraph::builder::makeConcat({tanh, add}, 1);
+        concat->add_control_dependency(memoryWrite);
+        auto fc3 = ngraph::builder::makeFullyConnected(concat, ngPrc, size, false, {},
+                                                       CommonTestUtils::generate_float_numbers(2 * size * size, -0.1f, 0.1f, 3));
+        auto sigmoid = ngraph::builder::makeActivation(fc3, ngPrc, ngraph::helpers::ActivationTypes::Sigmoid);
+        auto fc4 = ngraph::builder::makeFullyConnected(sigmoid, ngPrc, size, false, {},
+                                                       CommonTestUtils::generate_float_numbers(size * size, -0.2f, 0.2f, 4));
+
+        function = std::make_shared<ngraph::Function>(fc4, params, "CompactMode");
+    }
+
+    // Outputs of consecutive inferences of one request, so the memory layer carries state between them
+    std::vector<std::vector<float>> InferSequence(const std::string& compactMode) {
+        configuration[GNA_CONFIG_KEY(COMPACT_MODE)] = compactMode;
+        LoadNetwork();
+        inferRequest = executableNetwork.CreateInferRequest();
+        const auto& inputName = executableNetwork.GetInputsInfo().begin()->first;
+        const auto& outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+        std::vector<std::vector<float>> outputs;
+        for (const auto& input : inputs) {
+            inferRequest.SetBlob(inputName, input);
+            inferRequest.Infer();
+            auto output = inferRequest.GetBlob(outputName);
+            auto data = output->cbuffer().as<const float*>();
+            outputs.emplace_back(data, data + output->size());
+        }
+        return outputs;
+    }
+};
+
+TEST_P(CompactModeTest, CompareWithNonCompactMode) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    cnnNetwork = InferenceEngine::CNNNetwork{function};
+    const auto& inputInfo = *cnnNetwork.getInputsInfo().begin()->second;
+    for (int seed = 1; seed <= 3; seed++) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob(inputInfo.getTensorDesc(), 2, -1, 100, seed));
+    }
+
+    const auto expected = InferSequence(CONFIG_VALUE(NO));
+    const auto actual = InferSequence(CONFIG_VALUE(YES));
+    ASSERT_EQ(expected, actual);
+}
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {
+                {"GNA_DEVICE_MODE", "GNA_SW_EXACT"},
+                {"GNA_SCALE_FACTOR_0", "1024"}
+        },
+        {
+                {"GNA_DEVICE_MODE", "GNA_SW_FP32"}
+        }
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_CompactMode, CompactModeTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(CommonTestUtils::DEVICE_GNA),
+                                ::testing::ValuesIn(configs)),
+                        CompactModeTest::getTestCaseName);
+
+} // namespace LayerTestsDefinitions
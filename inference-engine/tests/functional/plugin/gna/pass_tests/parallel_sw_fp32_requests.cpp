@@ -0,0 +1,163 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <string>
+
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "shared_test_classes/subgraph/basic_lstm.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+enum class ParallelRequestsTopology {
+    AFFINE_PWL,
+    RECURRENT,
+    CONVOLUTION
+};
+
+typedef std::tuple<
+        ParallelRequestsTopology,           // Topology
+        std::string,                        // Target Device
+        std::map<std::string, std::string>  // Configuration
+> ParallelSwFp32RequestsParams;
+
+namespace LayerTestsDefinitions {
+
+/**
+ * Requests of GNA_SW_FP32 network with several library threads run concurrently, each on own copy of RW memory.
+ * Outputs of requests started at the same time on different inputs must match the ones of the network with one thread.
+ */
+class ParallelSwFp32RequestsTest : public testing::WithParamInterface<ParallelSwFp32RequestsParams>,
+                                   public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ParallelSwFp32RequestsParams> obj) {
+        ParallelRequestsTopology topology;
+        std::string targetDevice;
+        std::map<std::string, std::string> configuration;
+        std::tie(topology, targetDevice, configuration) = obj.param;
+
+        const char* topologyNames[] = {"AffinePwl", "Recurrent", "Convolution"};
+        std::ostringstream result;
+        result << "topology=" << topologyNames[static_cast<int>(topology)] << "_";
+        result << "targetDevice=" << targetDevice << "_";
+        for (auto const& configItem : configuration) {
+            result << "_configItem=" << configItem.first << "_" << configItem.second;
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ParallelRequestsTopology topology;
+        std::tie(topology, targetDevice, configuration) = this->GetParam();
+        auto ngPrc = ngraph::element::f32;
+
+        switch (topology) {
+        case ParallelRequestsTopology::AFFINE_PWL: {
+            auto params = ngraph::builder::makeParams(ngPrc, { {1, 64} });
+            auto fc1 = ngraph::builder::makeFullyConnected(params[0], ngPrc, 48, true, {},
+                                                           CommonTestUtils::generate_float_numbers(64 * 48, -0.2f, 0.2f, 1), {0.1f});
+            auto sigmoid = ngraph::builder::makeActivation(fc1, ngPrc, ngraph::helpers::ActivationTypes::Sigmoid);
+            auto fc2 = ngraph::builder::makeFullyConnected(sigmoid, ngPrc, 32, true, {},
+                                                           CommonTestUtils::generate_float_numbers(48 * 32, -0.2f, 0.2f, 2), {-0.1f});
+            auto tanh = ngraph::builder::makeActivation(fc2, ngPrc, ngraph::helpers::ActivationTypes::Tanh);
+            function = std::make_shared<ngraph::Function>(tanh, params, "ParallelAffinePwl");
+            break;
+        }
+        case ParallelRequestsTopology::RECURRENT:
+            function = SubgraphTestsDefinitions::Basic_LSTM_S::GetNetwork(16, 32);
+            break;
+        case ParallelRequestsTopology::CONVOLUTION: {
+            const size_t width = 168, kernel = 8, channels = 8;
+            auto params = ngraph::builder::makeParams(ngPrc, { {1, 1, 1, width} });
+            auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {1, kernel}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                         ngraph::op::PadType::VALID, channels, true,
+                                                         CommonTestUtils::generate_float_numbers(channels * kernel, -0.2f, 0.2f, 3));
+            auto pattern = std::make_shared<ngraph::opset1::Constant>(ngraph::element::Type_t::i64, ngraph::Shape{ 2 },
+                                                                      std::vector<size_t>{1, channels * (width - kernel + 1)});
+            auto reshape = std::make_shared<ngraph::opset1::Reshape>(conv, pattern, false);
+            auto fc = ngraph::builder::makeFullyConnected(reshape, ngPrc, 16, false, {},
+                                                          CommonTestUtils::generate_float_numbers(channels * (width - kernel + 1) * 16,
+                                                                                                  -0.05f, 0.05f, 4));
+            auto relu = ngraph::builder::makeActivation(fc, ngPrc, ngraph::helpers::ActivationTypes::Relu);
+            function = std::make_shared<ngraph::Function>(relu, params, "ParallelConvolution");
+            break;
+        }
+        }
+    }
+
+    std::vector<float> GetOutput(InferenceEngine::InferRequest& request) {
+        auto output = request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+        auto data = output->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + output->size());
+    }
+};
+
+TEST_P(ParallelSwFp32RequestsTest, CompareWithSingleThread) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    cnnNetwork = InferenceEngine::CNNNetwork{function};
+    const auto& inputName = cnnNetwork.getInputsInfo().begin()->first;
+    const auto& inputInfo = *cnnNetwork.getInputsInfo().begin()->second;
+    for (int seed = 1; seed <= 4; seed++) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob(inputInfo.getTensorDesc(), 2, -1, 100, seed));
+    }
+
+    configuration[GNA_CONFIG_KEY(LIB_N_THREADS)] = "1";
+    LoadNetwork();
+    std::vector<std::vector<float>> expected;
+    for (const auto& input : inputs) {
+        inferRequest = executableNetwork.CreateInferRequest();
+        inferRequest.SetBlob(inputName, input);
+        inferRequest.Infer();
+        expected.push_back(GetOutput(inferRequest));
+    }
+
+    configuration[GNA_CONFIG_KEY(LIB_N_THREADS)] = "2";
+    LoadNetwork();
+    std::vector<InferenceEngine::InferRequest> requests = {executableNetwork.CreateInferRequest(),
+                                                           executableNetwork.CreateInferRequest()};
+    // requests swap inputs between rounds, so every slot computes every input
+    const std::vector<std::pair<size_t, size_t>> rounds = {{0, 1}, {2, 3}, {1, 0}, {3, 2}};
+    for (const auto& round : rounds) {
+        const size_t inputIdx[] = {round.first, round.second};
+        for (size_t r = 0; r < requests.size(); r++) {
+            requests[r].SetBlob(inputName, inputs[inputIdx[r]]);
+        }
+        for (auto& request : requests) {
+            request.StartAsync();
+        }
+        for (size_t r = 0; r < requests.size(); r++) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, requests[r].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            ASSERT_EQ(expected[inputIdx[r]], GetOutput(requests[r])) << "input " << inputIdx[r] << ", request " << r;
+        }
+    }
+}
+
+const std::vector<ParallelRequestsTopology> topologies = {
+        ParallelRequestsTopology::AFFINE_PWL,
+        ParallelRequestsTopology::RECURRENT,
+        ParallelRequestsTopology::CONVOLUTION,
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {
+                {"GNA_DEVICE_MODE", "GNA_SW_FP32"}
+        }
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ParallelSwFp32Requests, ParallelSwFp32RequestsTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(topologies),
+                                ::testing::Values(CommonTestUtils::DEVICE_GNA),
+                                ::testing::ValuesIn(configs)),
+                        ParallelSwFp32RequestsTest::getTestCaseName);
+
+} // namespace LayerTestsDefinitions
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
 #include <vector>
 
 #include <ie_core.hpp>
@@ -581,4 +582,73 @@ TEST_P(PreprocessTest, SetScalePreProcessSetBlob) {
     }
 }
 
+TEST_P(PreprocessTest, SetResizePreProcessAsyncSetBlob) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        ngraph::PartialShape shape({1, 3, 10, 10});
+        ngraph::element::Type type(ngraph::element::Type_t::f32);
+        auto param = std::make_shared<ngraph::op::Parameter>(type, shape);
+        param->set_friendly_name("param");
+        auto relu = std::make_shared<ngraph::op::Relu>(param);
+        relu->set_friendly_name("relu");
+        auto result = std::make_shared<ngraph::op::Result>(relu);
+        result->set_friendly_name("result");
+
+        ngraph::ParameterVector params = {param};
+        ngraph::ResultVector results = {result};
+
+        ngraph = std::make_shared<ngraph::Function>(results, params);
+    }
+
+    // Create CNNNetwork from ngrpah::Function
+    InferenceEngine::CNNNetwork cnnNet(ngraph);
+
+    auto inputInfo = cnnNet.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(InferenceEngine::Precision::U8);
+    inputInfo->getPreProcess().setResizeAlgorithm(InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR);
+    // Load CNNNetwork to target plugins
+    auto execNet = ie->LoadNetwork(cnnNet, targetDevice, configuration);
+    const auto outName = cnnNet.getOutputsInfo().begin()->first;
+
+    // Requests with inputs of different sizes are pre-processed and inferred at the same time
+    const size_t requestsNum = 4;
+    std::vector<InferenceEngine::InferRequest> requests;
+    std::vector<InferenceEngine::Blob::Ptr> inBlobs;
+    for (size_t r = 0; r < requestsNum; r++) {
+        auto inBlob = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::U8,
+                                                                           {1, 3, 8 + 6 * r, 12 + 4 * r},
+                                                                           InferenceEngine::Layout::NCHW));
+        inBlob->allocate();
+        auto *inData = inBlob->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < inBlob->size(); i++)
+            inData[i] = static_cast<uint8_t>((i * 7 + r * 13) % 255);
+        inBlobs.push_back(inBlob);
+
+        requests.push_back(execNet.CreateInferRequest());
+        requests.back().SetBlob("param", inBlob);
+    }
+
+    for (auto &req : requests)
+        req.StartAsync();
+    for (auto &req : requests)
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, req.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+
+    // Check output against synchronous inference of the same input
+    for (size_t r = 0; r < requestsNum; r++) {
+        auto refReq = execNet.CreateInferRequest();
+        refReq.SetBlob("param", inBlobs[r]);
+        refReq.Infer();
+
+        auto refBlob = refReq.GetBlob(outName);
+        auto outBlob = requests[r].GetBlob(outName);
+        ASSERT_EQ(refBlob->byteSize(), outBlob->byteSize());
+        auto refMem = refBlob->cbuffer();
+        auto outMem = outBlob->cbuffer();
+        ASSERT_EQ(0, std::memcmp(refMem.as<const void*>(), outMem.as<const void*>(), outBlob->byteSize()))
+            << "Request " << r;
+    }
+}
+
 }  // namespace BehaviorTestsDefinitions
@@ -332,3 +332,73 @@ TEST_P(VariableStateTest, inferreq_smoke_VariableState_2infers) {
         }
     }
 }
+
+TEST_P(VariableStateTest, inferreq_smoke_VariableState_SetState_2infers) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto executableNet = PrepareNetwork();
+    auto inferReq = executableNet.CreateInferRequest();
+
+    // r_1-3 and c_1-3 hold the previous values of the states read by Memory_1 and Memory_2:
+    // c_1-3 = c * r * input, r_1-3 = sigmoid(c_1-3)
+    const float input_val = 0.5f;
+    for (const auto &input : executableNet.GetInputsInfo()) {
+        auto inBlob = make_blob_with_precision(input.second->getTensorDesc());
+        inBlob->allocate();
+        auto in_data = inBlob->buffer().as<float*>();
+        std::fill(in_data, in_data + inBlob->size(), input_val);
+        inferReq.SetBlob(input.first, inBlob);
+    }
+
+    auto fillState = [](InferenceEngine::VariableState &state, float value) {
+        auto stateBlob = make_blob_with_precision(state.GetState()->getTensorDesc());
+        stateBlob->allocate();
+        auto state_data = stateBlob->buffer().as<float*>();
+        std::fill(state_data, state_data + stateBlob->size(), value);
+        state.SetState(stateBlob);
+    };
+    auto checkState = [](InferenceEngine::VariableState &state, float expected) {
+        auto lastState = state.GetState();
+        auto last_state_data = lastState->cbuffer().as<const float*>();
+        ASSERT_TRUE(lastState->size() != 0) << "State size should not be 0";
+        for (size_t j = 0; j < lastState->size(); ++j) {
+            ASSERT_NEAR(expected, last_state_data[j], 1e-2) << "State " << state.GetName() << ", element " << j;
+        }
+    };
+    auto checkOutput = [&](const std::string &name, float expected) {
+        auto outBlob = inferReq.GetBlob(name);
+        auto out_data = outBlob->cbuffer().as<const float*>();
+        for (size_t j = 0; j < outBlob->size(); ++j) {
+            ASSERT_NEAR(expected, out_data[j], 1e-2) << "Output " << name << ", element " << j;
+        }
+    };
+    auto sigmoid = [](float x) { return 1.f / (1.f + std::exp(-x)); };
+
+    float r = 2.f, c = 3.f;
+    for (auto&& state : inferReq.QueryState()) {
+        fillState(state, state.GetName() == "r_1-3" ? r : c);
+    }
+
+    for (int i = 0; i < 2; i++) {
+        inferReq.Infer();
+        checkOutput("Memory_1", r);
+        checkOutput("Memory_2", c);
+
+        c = c * r * input_val;
+        r = sigmoid(c);
+        for (auto&& state : inferReq.QueryState()) {
+            checkState(state, state.GetName() == "r_1-3" ? r : c);
+        }
+    }
+
+    for (auto&& state : inferReq.QueryState()) {
+        state.Reset();
+        checkState(state, 0.f);
+    }
+    inferReq.Infer();
+    checkOutput("Memory_1", 0.f);
+    checkOutput("Memory_2", 0.f);
+    for (auto&& state : inferReq.QueryState()) {
+        checkState(state, state.GetName() == "r_1-3" ? 0.5f : 0.f);
+    }
+}
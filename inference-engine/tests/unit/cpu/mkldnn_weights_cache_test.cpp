@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+#include <ie_blob.h>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+std::vector<uint8_t> makeData(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+    return data;
+}
+
+// Byte-at-a-time ECMA-182 sum
+uint64_t referenceCRC(const uint8_t* data, size_t size) {
+    uint64_t table[256];
+    for (int i = 0; i < 256; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+        table[i] = c;
+    }
+    uint64_t crc = 0;
+    for (size_t idx = 0; idx < size; idx++)
+        crc = table[(uint8_t)crc ^ data[idx]] ^ (crc >> 8);
+    return ~crc;
+}
+
+}  // namespace
+
+TEST(WeightsCacheTest, HashOfSmallDataIsCRC64) {
+    const auto data = makeData(4099);
+    const auto &hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    for (size_t size : {0, 1, 7, 8, 9, 64, 1001, 4099})
+        ASSERT_EQ(referenceCRC(data.data(), size), hashFunc.hash(data.data(), size)) << "size " << size;
+}
+
+TEST(WeightsCacheTest, HashOfLargeDataDependsOnEveryByte) {
+    auto data = makeData(3 * 1024 * 1024 + 17);
+    const auto &hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    const uint64_t hash = hashFunc.hash(data.data(), data.size());
+    ASSERT_EQ(hash, hashFunc.hash(data.data(), data.size()));
+
+    for (size_t idx : {size_t(0), data.size() / 2, data.size() - 1}) {
+        data[idx] ^= 1;
+        ASSERT_NE(hash, hashFunc.hash(data.data(), data.size())) << "byte " << idx;
+        data[idx] ^= 1;
+    }
+    ASSERT_NE(hash, hashFunc.hash(data.data(), data.size() - 1));
+}
+
+TEST(WeightsCacheTest, HashOfBlobIsMemoized) {
+    const auto data = makeData(1000);
+    auto blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {data.size()}, Layout::C));
+    blob->allocate();
+    std::copy(data.begin(), data.end(), blob->buffer().as<uint8_t*>());
+
+    MKLDNNWeightsSharing cache;
+    const uint64_t hash = cache.hashOf(blob);
+    ASSERT_EQ(MKLDNNWeightsSharing::GetHashFunc().hash(data.data(), data.size()), hash);
+
+    // the data of the blob is not hashed again
+    blob->buffer().as<uint8_t*>()[0] ^= 1;
+    ASSERT_EQ(hash, cache.hashOf(blob));
+
+    auto other = make_shared_blob<uint8_t>(blob->getTensorDesc());
+    other->allocate();
+    std::copy(data.begin(), data.end(), other->buffer().as<uint8_t*>());
+    other->buffer().as<uint8_t*>()[0] ^= 1;
+    ASSERT_NE(hash, cache.hashOf(other));
+}
@@ -0,0 +1,237 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+// the plugin is built without MKL, so the reference cblas routines are declared only with this define
+#ifndef _NO_MKL_
+#define _NO_MKL_
+#endif
+#include "runtime/floatmath.h"
+#include "runtime/gna_float_runtime.hpp"
+#include "runtime/pwl.h"
+
+namespace {
+
+using SgemmShape = std::tuple<int, int, int>;  // M, N, K
+
+class GNAFloatMathTest : public ::testing::TestWithParam<SgemmShape> {
+protected:
+    static std::vector<float> make_data(size_t size, int seed) {
+        std::vector<float> data(size);
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<float>((i * 7 + seed * 13) % 23) / 11.0f - 1.0f;
+        }
+        return data;
+    }
+};
+
+TEST_P(GNAFloatMathTest, sgemmMatchesNaiveReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    const auto A = make_data(M * K, 1);
+    const auto B = make_data(K * N, 2);
+    auto C = make_data(M * N, 3);
+
+    std::vector<float> ref = C;
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < K; k++) {
+                ref[i * N + j] += A[i * K + k] * B[k * N + j];
+            }
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C.data(), N);
+
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_NEAR(ref[i], C[i], 1e-3f) << "at " << i;
+    }
+}
+
+TEST_P(GNAFloatMathTest, sgemmSubsetMatchesNaiveReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    const auto A = make_data(M * K, 4);
+    const auto B = make_data(K * N, 5);
+
+    std::vector<uint32_t> rows;
+    for (int i = M - 1; i >= 0; i -= 2) {
+        rows.push_back(i);
+    }
+    const int L = static_cast<int>(rows.size());
+    std::vector<float> C(L * N, 42.0f);
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 0.0, C.data(), N,
+                       rows.data(), L);
+
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            float ref = 0.0f;
+            for (int k = 0; k < K; k++) {
+                ref += A[rows[l] * K + k] * B[k * N + j];
+            }
+            ASSERT_NEAR(ref, C[l * N + j], 1e-3f) << "at " << l << ", " << j;
+        }
+    }
+}
+
+TEST_P(GNAFloatMathTest, sgemvSplitMatchesNaiveReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    const uint32_t K1 = K / 3;
+    const uint32_t K2 = K - K1;
+    const auto X = make_data(M * K, 6);
+    const auto A1 = make_data(K1, 7);
+    const auto A2 = make_data(K2, 8);
+    const auto bias = make_data(M, 9);
+    std::vector<float> C(M);
+
+    sgemv_split(M, K1, K2, A1.data(), A2.data(), X.data(), bias.data(), C.data());
+
+    for (int i = 0; i < M; i++) {
+        float ref = bias[i];
+        for (uint32_t k = 0; k < K1; k++) {
+            ref += A1[k] * X[i * K + k];
+        }
+        for (uint32_t k = 0; k < K2; k++) {
+            ref += A2[k] * X[i * K + K1 + k];
+        }
+        ASSERT_NEAR(ref, C[i], 1e-3f) << "at " << i;
+    }
+}
+
+TEST_P(GNAFloatMathTest, diagonalMatchesCblasSsbmv) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    auto weights = make_data(M, 10);
+    auto bias = make_data(M, 11);
+    auto input = make_data(M * N, 12);
+    std::vector<float> output(M * N);
+
+    intel_dnn_component_t component;
+    component.num_rows_in = component.num_rows_out = M;
+    component.num_columns_in = component.num_columns_out = N;
+    component.num_bytes_per_input = sizeof(float);
+    component.op.affine.ptr_weights = weights.data();
+    component.op.affine.ptr_biases = bias.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    GNAPluginNS::runtime::FP::ApplyDiagonalTransform(&component);
+
+    std::vector<float> ref(M * N);
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            ref[i * N + j] = bias[i];
+        }
+    }
+    for (int j = 0; j < N; j++) {
+        cblas_ssbmv1(CblasRowMajor, CblasLower, M, 0, 1.0, weights.data(), 1, input.data() + j * M, 1, 1.0, ref.data() + j * M, 1);
+    }
+    ASSERT_EQ(ref, output);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMath, GNAFloatMathTest,
+                        ::testing::Values(SgemmShape{1, 1, 1},
+                                          SgemmShape{5, 3, 7},
+                                          SgemmShape{37, 4, 531},
+                                          SgemmShape{130, 8, 1100},
+                                          SgemmShape{4099, 17, 1}));
+
+using PwlApplyParams = std::tuple<DnnActivationType, uint32_t, uint32_t>;  // activation, rows, columns
+
+class GNAPwlApply32Test : public ::testing::TestWithParam<PwlApplyParams> {
+protected:
+    static DnnActivation makeActivation(DnnActivationType type) {
+        auto activation = DnnActivation::fromType(type);
+        if (type == kActRelu) {
+            activation.args.lrelu.negative_slope = 0.125f;
+        } else if (type == kActKaldiLstmClipping) {
+            activation.args.clamp = {-5.0f, 7.5f};
+        }
+        return activation;
+    }
+
+    // transcendental activations are compared with double precision, arithmetic ones must be exact
+    static double reference(const DnnActivation& activation, float x, double& tolerance) {
+        tolerance = 0.0;
+        switch (activation.type) {
+            case kActSigmoid:
+                tolerance = 1e-6;
+                return 0.5 * (1.0 + std::tanh(0.5 * x));
+            case kActTanh:
+                // small values are not flushed to zero
+                tolerance = std::fabs(x) < 1e-3f ? std::fabs(x) * 1e-6 : 1e-6;
+                return std::tanh(x);
+            case kActRelu:
+                return x < 0.0f ? x * activation.args.lrelu.negative_slope : x;
+            case kActKaldiLstmClipping:
+                return std::min(std::max(x, activation.args.clamp.low), activation.args.clamp.high);
+            case kActSign:
+                return x == 0.0f ? 0.0f : (x > 0.0f ? 1.0f : -1.0f);
+            default:
+                ADD_FAILURE() << "no reference for activation " << activation.type;
+                return 0.0;
+        }
+    }
+
+    // Applies the activation to the columns [col_start, col_end] of every row, the other columns must stay untouched
+    void checkWindow(uint32_t col_start, uint32_t col_end) {
+        DnnActivationType type;
+        uint32_t rows, columns;
+        std::tie(type, rows, columns) = GetParam();
+
+        std::vector<float> input(rows * columns);
+        for (size_t i = 0; i < input.size(); i++) {
+            // covers the saturated range, the range near zero, zeros and the subnormals
+            input[i] = (i % 3 == 0) ? std::ldexp(static_cast<float>(i % 7) - 3.0f, -static_cast<int>(i % 140))
+                                    : static_cast<float>(static_cast<int>(i % 2001) - 1000) / 50.0f;
+        }
+        std::vector<float> output(input.size(), -42.0f);
+
+        intel_dnn_component_t component;
+        component.num_rows_in = rows;
+        component.num_columns_in = columns;
+        component.op.pwl.func_id = makeActivation(type);
+        component.ptr_inputs = input.data();
+        component.ptr_outputs = output.data();
+        PwlApply32(&component, 0, rows - 1, col_start, col_end);
+
+        for (uint32_t i = 0; i < rows; i++) {
+            for (uint32_t j = 0; j < columns; j++) {
+                const size_t idx = i * columns + j;
+                if (j < col_start || j > col_end) {
+                    ASSERT_EQ(-42.0f, output[idx]) << "at " << idx;
+                    continue;
+                }
+                double tolerance = 0.0;
+                const double ref = reference(component.op.pwl.func_id, input[idx], tolerance);
+                ASSERT_NEAR(ref, output[idx], tolerance) << "at " << idx << ", x = " << input[idx];
+            }
+        }
+    }
+};
+
+TEST_P(GNAPwlApply32Test, wholeRowsMatchReference) {
+    // 40x1001 is evaluated as a flat range in parallel chunks, the last one is partial
+    checkWindow(0, std::get<2>(GetParam()) - 1);
+}
+
+TEST_P(GNAPwlApply32Test, partialRowsMatchReference) {
+    const uint32_t columns = std::get<2>(GetParam());
+    if (columns <= 2) {
+        return;
+    }
+    checkWindow(1, columns - 2);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMath, GNAPwlApply32Test,
+                        ::testing::Combine(::testing::Values(kActSigmoid, kActTanh, kActRelu, kActKaldiLstmClipping, kActSign),
+                                           ::testing::Values(1, 3, 40),
+                                           ::testing::Values(1, 9, 1001)));
+
+}  // namespace
@@ -181,6 +181,13 @@ TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsTest) {
     ExpectThrow(GNA_CONFIG_KEY(LIB_N_THREADS), "abc");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsInSwFp32ModeTest) {
+    SetAndCompare(GNA_CONFIG_KEY(DEVICE_MODE), GNAConfigParams::GNA_SW_FP32);
+    SetAndCompare(GNA_CONFIG_KEY(LIB_N_THREADS), "4");
+    EXPECT_TRUE(config.gnaFlags.sw_fp32);
+    EXPECT_EQ(config.gnaFlags.gna_lib_async_threads_num, 4);
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigSingleThreadTest) {
     SetAndCheckFlag(CONFIG_KEY(SINGLE_THREAD),
                     config.gnaFlags.gna_openmp_multithreading,
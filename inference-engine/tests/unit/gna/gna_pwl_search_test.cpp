@@ -0,0 +1,159 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "runtime/pwl.h"
+
+namespace {
+
+class GNAPwlSearchTest : public ::testing::TestWithParam<DnnActivationType> {
+protected:
+    static void ExpectSamePwl(const std::vector<pwl_t>& expected, const std::vector<pwl_t>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_DOUBLE_EQ(expected[i].alpha, actual[i].alpha) << "at " << i;
+            EXPECT_DOUBLE_EQ(expected[i].beta, actual[i].beta) << "at " << i;
+            EXPECT_DOUBLE_EQ(expected[i].m, actual[i].m) << "at " << i;
+            EXPECT_DOUBLE_EQ(expected[i].b, actual[i].b) << "at " << i;
+        }
+    }
+};
+
+TEST_P(GNAPwlSearchTest, repeatedSearchReturnsSameDesign) {
+    const auto activation = DnnActivation::fromType(GetParam());
+    double err_pct = 0.0;
+    const auto pwl = pwl_search(activation, -5.0, 5.0, PWL_DESIGN_THRESHOLD, 0.5, PWL_DESIGN_SAMPLES, err_pct);
+    ASSERT_FALSE(pwl.empty());
+    EXPECT_LE(err_pct, 0.5);
+
+    double err_pct_again = 0.0;
+    const auto pwl_again = pwl_search(activation, -5.0, 5.0, PWL_DESIGN_THRESHOLD, 0.5, PWL_DESIGN_SAMPLES, err_pct_again);
+    EXPECT_DOUBLE_EQ(err_pct, err_pct_again);
+    ExpectSamePwl(pwl, pwl_again);
+}
+
+TEST_P(GNAPwlSearchTest, searchDependsOnAllowedError) {
+    const auto activation = DnnActivation::fromType(GetParam());
+    double coarse_err_pct = 0.0;
+    double fine_err_pct = 0.0;
+    const auto coarse = pwl_search(activation, -5.0, 5.0, PWL_DESIGN_THRESHOLD, 1.0, PWL_DESIGN_SAMPLES, coarse_err_pct);
+    const auto fine = pwl_search(activation, -5.0, 5.0, PWL_DESIGN_THRESHOLD, 0.1, PWL_DESIGN_SAMPLES, fine_err_pct);
+    EXPECT_LT(coarse.size(), fine.size());
+    EXPECT_LE(fine_err_pct, 0.1);
+}
+
+TEST(GNAPwlSearchPowTest, searchDependsOnPowArguments) {
+    auto square = DnnActivation::fromType(kActPow);
+    square.args.pow = {2.0f, 1.0f, 0.0f};
+    auto cube = DnnActivation::fromType(kActPow);
+    cube.args.pow = {3.0f, 1.0f, 0.0f};
+
+    double err_pct = 0.0;
+    const auto square_pwl = pwl_search(square, 0.0, 4.0, PWL_DESIGN_THRESHOLD, 0.5, PWL_DESIGN_SAMPLES, err_pct);
+    const auto cube_pwl = pwl_search(cube, 0.0, 4.0, PWL_DESIGN_THRESHOLD, 0.5, PWL_DESIGN_SAMPLES, err_pct);
+    ASSERT_FALSE(square_pwl.empty());
+    ASSERT_FALSE(cube_pwl.empty());
+    EXPECT_NE(square_pwl.back().beta, cube_pwl.back().beta);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAPwlSearch, GNAPwlSearchTest,
+                        ::testing::Values(kActSigmoid, kActTanh, kActSoftSign));
+
+struct PwlGolden {
+    DnnActivationType type;
+    double l_bound;
+    double u_bound;
+    double err_pct;
+    std::vector<pwl_t> segments;  // {t, alpha, beta, m, b}, t is not compared
+};
+
+// Designs at 1% allowed error produced by the search before it was rewritten and cached
+const std::vector<PwlGolden> pwlGoldens = {
+    {kActSigmoid, -10.0, 10.0, 0.76062224274829948, {
+        {0.0, -10.0, -0.0033685324745532531, 0.0024011761556240077, 0.020643229081686823},
+        {0.0, -4.2646607997060624, 0.010403027257608216, 0.029619100828046807, 0.13671844548152082},
+        {0.0, -2.7960754970003254, 0.053901203413037058, 0.082620267964448268, 0.28491371022403178},
+        {0.0, -1.8482809500056467, 0.13220824286098024, 0.15455301637191463, 0.41786563878710092},
+        {0.0, -1.0390898867848257, 0.25727116250295479, 0.22963741468060328, 0.49588507772498291},
+        {0.0, 0.0, 0.50411492227501709, 0.22963741468060325, 0.50411492227501709},
+        {0.0, 1.0390898867848253, 0.7427288374970451, 0.15455301637191451, 0.58213436121289919},
+        {0.0, 1.8482809500056492, 0.86779175713902001, 0.082620267964447991, 0.71508628977596878},
+        {0.0, 2.7960754970003263, 0.94609879658696283, 0.029619100828046918, 0.86328155451847877},
+        {0.0, 4.2646607997060606, 0.98959697274239178, 0.0024011761556240298, 0.97935677091831308},
+        {0.0, 10.0, 1.0033685324745534, 0.0, 0.0}
+    }},
+    {kActTanh, -5.0, 5.0, 0.76062224274829271, {
+        {0.0, -5.0, -1.0067370649491065, 0.0096047046224959371, -0.95871354183662683},
+        {0.0, -2.1323303998530339, -0.979193945484784, 0.11847640331218724, -0.72656310903695842},
+        {0.0, -1.3980377485001632, -0.892197593173926, 0.3304810718577928, -0.43017257955193672},
+        {0.0, -0.92414047500282348, -0.73558351427803959, 0.61821206548765828, -0.16426872242579849},
+        {0.0, -0.51954494339241275, -0.48545767499409032, 0.91854965872241312, -0.0082298445500341155},
+        {0.0, 0.0, 0.0082298445500341155, 0.91854965872241323, 0.0082298445500341155},
+        {0.0, 0.51954494339241275, 0.48545767499409037, 0.6182120654876585, 0.16426872242579826},
+        {0.0, 0.92414047500282415, 0.73558351427804003, 0.33048107185779213, 0.43017257955193755},
+        {0.0, 1.3980377485001632, 0.89219759317392588, 0.11847640331218723, 0.72656310903695842},
+        {0.0, 2.1323303998530312, 0.97919394548478356, 0.0096047046224960447, 0.95871354183662627},
+        {0.0, 5.0, 1.0067370649491065, 0.0, 0.0}
+    }},
+    {kActSoftSign, -10.0, 10.0, 0.76237518495790124, {
+        {0.0, -10.0, -0.91523380232295548, 0.015671173149834836, -0.7585220708246071},
+        {0.0, -4.7959272510895588, -0.83367987719044301, 0.048349561546906193, -0.60179889738940373},
+        {0.0, -2.5610762696796043, -0.72562581211659882, 0.11678802004659543, -0.42652278539239735},
+        {0.0, -1.3988706918750828, -0.58989412379769934, 0.24204728831565056, -0.25130126612509757},
+        {0.0, -0.71885001455609732, -0.42529696285406687, 0.45102727044971913, -0.10107600292608943},
+        {0.0, -0.28829940437100265, -0.23110689635182252, 0.77589411203271363, -0.0074170859978231751},
+        {0.0, 0.0, 0.0074170859978231682, 0.77589411203271363, 0.0074170859978231682},
+        {0.0, 0.28829940437100321, 0.23110689635182297, 0.45102727044971846, 0.10107600292608976},
+        {0.0, 0.71885001455609876, 0.42529696285406737, 0.2420472883156502, 0.25130126612509796},
+        {0.0, 1.3988706918750846, 0.58989412379769968, 0.11678802004659533, 0.42652278539239763},
+        {0.0, 2.5610762696796052, 0.72562581211659893, 0.048349561546906207, 0.60179889738940395},
+        {0.0, 4.7959272510895499, 0.83367987719044279, 0.015671173149834853, 0.75852207082460699},
+        {0.0, 10.0, 0.91523380232295548, 0.0, 0.0}
+    }},
+    {kActExp, -2.0, 3.0, 0.87160840342550339, {
+        {0.0, -2.0, 0.1289233508854449, 0.1991693056559099, 0.52726196219726473},
+        {0.0, -1.2702998044283194, 0.2742572321744382, 0.37114641606065712, 0.74572445191056258},
+        {0.0, -0.73381522641767649, 0.47337156057490226, 0.59795618770550252, 0.91216091584386627},
+        {0.0, -0.30785274245501676, 0.72807846359078054, 0.88120389851734371, 0.99935950041139709},
+        {0.0, 0.044999999999999998, 0.87580075942847668, 2.0241242631272378, 0.78471516758775095},
+        {0.0, 1.2495533320730197, 3.3139663851082379, 5.1963942984599427, -3.1792054252976247},
+        {0.0, 2.0052789856876458, 7.2410148627511912, 9.9105255109917785, -12.632353681561939},
+        {0.0, 2.560911072289862, 12.747620831748046, 16.243613827171927, -28.850829672257248},
+        {0.0, 3.0, 19.880011809258537, -0.0, -0.0}
+    }},
+    {kActLog, 0.001, 100.0, 0.85544705852426761, {
+        {0.0, 0.001, -6.8000586170194897, 487.32462047489747, -7.287383237494387},
+        {0.0, 0.0036660770936253872, -5.5008136092116802, 132.89624841742753, -5.9880215013635603},
+        {0.0, 0.013407554138408977, -4.2062078559154523, 36.487034740297652, -4.6954097495460019},
+        {0.0, 0.048812060848294432, -2.9144023896287603, 10.029096017256286, -3.4039432346764613},
+        {0.0, 0.17662287004596011, -1.6325755121421484, 2.7947326503360697, -2.1261892138556577},
+        {0.0, 0.63468913175244379, -0.35240277453365171, 0.7761094007091236, -0.84499097621463481},
+        {0.0, 2.265057544379367, 0.91294147712531459, 0.22045971416835608, 0.41358753831656081},
+        {0.0, 8.0348567416068217, 2.1849497589548896, 0.061434329577096269, 1.6913337217862623},
+        {0.0, 28.377355178035355, 3.4346775123200057, 0.017819569187338673, 2.9290052683713212},
+        {0.0, 100.0, 4.7109621871051885, 0.0, 0.0}
+    }},
+};
+
+class GNAPwlSearchGoldenTest : public ::testing::TestWithParam<PwlGolden> {};
+
+TEST_P(GNAPwlSearchGoldenTest, searchMatchesReferenceDesign) {
+    const auto& golden = GetParam();
+    double err_pct = 0.0;
+    const auto pwl = pwl_search(DnnActivation::fromType(golden.type), golden.l_bound, golden.u_bound,
+                                PWL_DESIGN_THRESHOLD, 1.0, PWL_DESIGN_SAMPLES, err_pct);
+    EXPECT_DOUBLE_EQ(golden.err_pct, err_pct);
+    ASSERT_EQ(golden.segments.size(), pwl.size());
+    for (size_t i = 0; i < pwl.size(); i++) {
+        EXPECT_DOUBLE_EQ(golden.segments[i].alpha, pwl[i].alpha) << "at " << i;
+        EXPECT_DOUBLE_EQ(golden.segments[i].beta, pwl[i].beta) << "at " << i;
+        EXPECT_DOUBLE_EQ(golden.segments[i].m, pwl[i].m) << "at " << i;
+        EXPECT_DOUBLE_EQ(golden.segments[i].b, pwl[i].b) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(GNAPwlSearch, GNAPwlSearchGoldenTest, ::testing::ValuesIn(pwlGoldens));
+
+}  // namespace
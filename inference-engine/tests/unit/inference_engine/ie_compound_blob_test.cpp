@@ -47,6 +47,7 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 class I420BlobTests : public CompoundBlobTests {};
+class BatchedROIBlobTests : public CompoundBlobTests {};
 
 TEST(BlobConversionTests, canWorkWithMemoryBlob) {
     Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
@@ -424,4 +425,49 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
     EXPECT_THROW(make_shared_blob<I420Blob>(y_blob, v_blob, u_blob), InferenceEngine::details::InferenceEngineException);
 }
 
+TEST_F(BatchedROIBlobTests, canCreateBatchedROIBlobWithDifferentROISizes) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 8, 10}, NHWC));
+    image->allocate();
+    BatchedROIBlob::Ptr rois_blob = make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{
+        ROI(0, 0, 0, 4, 4), ROI(0, 2, 3, 8, 5), ROI(0, 1, 1, 3, 7)});
+    verifyCompoundBlob(rois_blob);
+    ASSERT_EQ(3, rois_blob->size());
+    EXPECT_EQ(SizeVector({3, 3, 8, 10}), rois_blob->getTensorDesc().getDims());
+    EXPECT_EQ(SizeVector({1, 3, 5, 8}), rois_blob->getBlob(1)->getTensorDesc().getDims());
+    EXPECT_EQ(SizeVector({1, 3, 7, 3}), rois_blob->getBlob(2)->getTensorDesc().getDims());
+}
+
+TEST_F(BatchedROIBlobTests, canCreateBatchedROIBlobFromNV12Image) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    y_blob->allocate();
+    uv_blob->allocate();
+    Blob::Ptr image = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    BatchedROIBlob::Ptr rois_blob = make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{
+        ROI(0, 0, 0, 4, 4), ROI(0, 2, 2, 6, 4)});
+    verifyCompoundBlob(rois_blob);
+    ASSERT_EQ(2, rois_blob->size());
+    EXPECT_TRUE(rois_blob->getBlob(0)->is<NV12Blob>());
+    EXPECT_TRUE(rois_blob->getBlob(1)->is<NV12Blob>());
+}
 
+TEST_F(BatchedROIBlobTests, cannotCreateBatchedROIBlobWithoutROIs) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 8, 10}, NHWC));
+    image->allocate();
+    EXPECT_THROW(make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedROIBlobTests, cannotCreateBatchedROIBlobFromBatchedImage) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 8, 10}, NHWC));
+    image->allocate();
+    EXPECT_THROW(make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{ROI(0, 0, 0, 4, 4)}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedROIBlobTests, cannotCreateBatchedROIBlobWithROIOutOfImage) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 8, 10}, NHWC));
+    image->allocate();
+    EXPECT_THROW(make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{ROI(0, 6, 0, 8, 4)}),
+                 InferenceEngine::details::InferenceEngineException);
+}
@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <threading/ie_cpu_topology.hpp>
+#include "common_test_utils/file_utils.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+// Fake sysfs of the single socket host with 4 cores, 2 SMT siblings per core (cpuN and cpuN+4)
+// and the L2 cache shared by cores {0, 2} and {1, 3}
+class CpuTopologyTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _root = "cpu_topology_test_sysfs";
+        writeFile("devices/system/cpu/online", "0-7\n");
+        writeFile("devices/system/node/online", "0\n");
+        writeFile("devices/system/node/node0/cpulist", "0-7\n");
+        for (int cpu = 0; cpu < 8; ++cpu) {
+            const int core = cpu % 4;
+            const auto cpuPath = "devices/system/cpu/cpu" + std::to_string(cpu) + "/";
+            writeFile(cpuPath + "topology/physical_package_id", "0\n");
+            writeFile(cpuPath + "topology/core_id", std::to_string(core) + "\n");
+            writeCache(cpuPath + "cache/index0/", 1, "Data", std::to_string(core) + "," + std::to_string(core + 4));
+            writeCache(cpuPath + "cache/index1/", 1, "Instruction", std::to_string(core) + "," + std::to_string(core + 4));
+            writeCache(cpuPath + "cache/index2/", 2, "Unified", (core % 2 == 0) ? "0,2,4,6" : "1,3,5,7");
+            writeCache(cpuPath + "cache/index3/", 3, "Unified", "0-7");
+        }
+    }
+
+    void TearDown() override {
+        for (auto&& file : _files) {
+            CommonTestUtils::removeFile(file);
+        }
+        for (auto dir = _dirs.rbegin(); dir != _dirs.rend(); ++dir) {
+            CommonTestUtils::removeDir(*dir);
+        }
+    }
+
+    void writeFile(const std::string& relativePath, const std::string& content) {
+        std::string path = _root;
+        if (!CommonTestUtils::directoryExists(path)) {
+            ASSERT_EQ(0, CommonTestUtils::createDirectory(path));
+            _dirs.push_back(path);
+        }
+        std::size_t begin = 0;
+        for (auto end = relativePath.find('/'); end != std::string::npos; end = relativePath.find('/', begin)) {
+            path = CommonTestUtils::makePath(path, relativePath.substr(begin, end - begin));
+            if (!CommonTestUtils::directoryExists(path)) {
+                ASSERT_EQ(0, CommonTestUtils::createDirectory(path));
+                _dirs.push_back(path);
+            }
+            begin = end + 1;
+        }
+        path = CommonTestUtils::makePath(path, relativePath.substr(begin));
+        CommonTestUtils::createFile(path, content);
+        _files.push_back(path);
+    }
+
+    void writeCache(const std::string& cachePath, int level, const std::string& type, const std::string& sharedCpus) {
+        writeFile(cachePath + "level", std::to_string(level) + "\n");
+        writeFile(cachePath + "type", type + "\n");
+        writeFile(cachePath + "shared_cpu_list", sharedCpus + "\n");
+    }
+
+    std::string                 _root;
+    std::vector<std::string>    _files;
+    std::vector<std::string>    _dirs;
+};
+
+TEST_F(CpuTopologyTests, returnsEmptyTopologyForMissingSysfs) {
+    ASSERT_TRUE(ParseCpuTopology("cpu_topology_test_missing_sysfs").empty());
+}
+
+TEST_F(CpuTopologyTests, countsPhysicalCoresAndSmtSiblings) {
+    auto topology = ParseCpuTopology(_root);
+    ASSERT_EQ(8u, topology._processors.size());
+    ASSERT_EQ(4, topology.GetCoresNumber());
+    ASSERT_EQ(std::vector<int>{0}, topology.GetNumaNodes());
+    for (auto&& processor : topology._processors) {
+        ASSERT_EQ(processor._cpu < 4 ? 0 : 1, processor._smtRank);
+        ASSERT_EQ(topology._processors[processor._cpu % 4]._core, processor._core);
+    }
+}
+
+TEST_F(CpuTopologyTests, groupsCoresByL2Cache) {
+    auto topology = ParseCpuTopology(_root);
+    ASSERT_EQ((std::vector<std::vector<int>>{{0, 2}, {1, 3}}), topology.GetCacheGroups());
+}
+
+TEST_F(CpuTopologyTests, pinsToSmtSiblingsAfterAllCores) {
+    auto topology = ParseCpuTopology(_root);
+    ASSERT_EQ((std::vector<int>{0, 2, 1, 3, 4, 6, 5, 7}), topology.GetPinningOrder());
+}
+
+TEST_F(CpuTopologyTests, skipsIsolatedCpus) {
+    writeFile("devices/system/cpu/isolated", "3\n");
+    auto topology = ParseCpuTopology(_root);
+    ASSERT_EQ(7u, topology._processors.size());
+    ASSERT_EQ(4, topology.GetCoresNumber());
+}
+
+// The root cgroup cpuset is not the one of the process, the process affinity mask is used by Restrict() instead
+TEST_F(CpuTopologyTests, skipsIsolatedAndAffinityRestrictedCpus) {
+    writeFile("devices/system/cpu/isolated", "3\n");
+    writeFile("fs/cgroup/cpuset.cpus.effective", "0-2\n");
+    auto topology = ParseCpuTopology(_root).Restrict({0, 1, 2, 4, 5, 6});
+    ASSERT_EQ(6u, topology._processors.size());
+    ASSERT_EQ(3, topology.GetCoresNumber());
+    ASSERT_EQ((std::vector<int>{0, 2, 1, 4, 6, 5}), topology.GetPinningOrder());
+}
+
+TEST_F(CpuTopologyTests, restrictedTopologyRanksRemainingSiblings) {
+    auto topology = ParseCpuTopology(_root).Restrict({1, 4, 5});
+    ASSERT_EQ(3u, topology._processors.size());
+    ASSERT_EQ(2, topology.GetCoresNumber());
+    ASSERT_EQ((std::vector<std::vector<int>>{{1}, {4}}), topology.GetCacheGroups());
+    ASSERT_EQ((std::vector<int>{1, 4, 5}), topology.GetPinningOrder());
+}
+
+TEST_F(CpuTopologyTests, readsNumaNodes) {
+    writeFile("devices/system/node/online", "0,2\n");
+    writeFile("devices/system/node/node0/cpulist", "0,2,4,6\n");
+    writeFile("devices/system/node/node2/cpulist", "1,3,5,7\n");
+    auto topology = ParseCpuTopology(_root);
+    ASSERT_EQ((std::vector<int>{0, 2}), topology.GetNumaNodes());
+    ASSERT_EQ(2, topology._processors[1]._numaNode);
+}
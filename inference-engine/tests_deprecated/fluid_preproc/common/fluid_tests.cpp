@@ -15,8 +15,10 @@
 #include <opencv2/gapi.hpp>
 #include <opencv2/gapi/imgproc.hpp>
 
+#include <cmath>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
 #include <chrono>
@@ -266,6 +268,49 @@ void Blob2Img(const InferenceEngine::Blob::Ptr& blobP, cv::Mat& img, InferenceEn
             THROW_IE_EXCEPTION << "Inconsistent input layout for image processing: " << layout;
     }
 }
+
+// Reference FP16/BF16 conversions: decoding is exact, encoding is used for values exact in 16 bits only
+float f16ToFloat(uint16_t h, bool bf16) {
+    uint32_t u = static_cast<uint32_t>(h) << 16;
+    if (!bf16) {
+        const uint32_t sign = (h & 0x8000u) << 16;
+        const uint32_t exp = (h >> 10) & 0x1fu;
+        const uint32_t mant = h & 0x3ffu;
+        if (exp == 0) {
+            const float value = std::ldexp(static_cast<float>(mant), -24);
+            return sign ? -value : value;
+        }
+        u = sign | ((exp == 0x1fu ? 0xffu : exp + 112) << 23) | (mant << 13);
+    }
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+uint16_t floatToF16Exact(float f, bool bf16) {
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    uint16_t h = static_cast<uint16_t>(u >> 16);
+    if (!bf16) {
+        const uint32_t exp = (u >> 23) & 0xffu;
+        h = static_cast<uint16_t>(((u >> 16) & 0x8000u) | (exp == 0 ? 0 : ((exp - 112) << 10) | ((u >> 13) & 0x3ffu)));
+    }
+    CV_Assert(f16ToFloat(h, bf16) == f);
+    return h;
+}
+
+cv::Mat convertF16(const cv::Mat &mat, bool bf16) {
+    cv::Mat result(mat.size(), CV_MAKE_TYPE(mat.depth() == CV_16U ? CV_32F : CV_16U, mat.channels()));
+    for (int y = 0; y < mat.rows; y++) {
+        for (int x = 0; x < mat.cols * mat.channels(); x++) {
+            if (mat.depth() == CV_16U)
+                result.ptr<float>(y)[x] = f16ToFloat(mat.ptr<uint16_t>(y)[x], bf16);
+            else
+                result.ptr<uint16_t>(y)[x] = floatToF16Exact(mat.ptr<float>(y)[x], bf16);
+        }
+    }
+    return result;
+}
 } // anonymous namespace
 
 TEST_P(ResizeTestGAPI, AccuracyTest)
@@ -659,6 +704,202 @@ TEST_P(ConvertDepthTestGAPI, AccuracyTest)
         EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
     }
 }
+
+TEST_P(ConvertF16TestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    auto precision    = std::get<0>(params);
+    cv::Size sz       = std::get<1>(params);
+    double tolerance  = std::get<2>(params);
+
+    initMatrixRandU(CV_32FC1, sz, CV_32FC1);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    ConvertF16RoundTripComputation cc(to_test(in_mat1), to_test(out_mat_gapi), precision == InferenceEngine::Precision::BF16);
+    cc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ cc.apply(); },
+        400, "ConvF16 GAPI %s %dx%d", precision.name(), sz.width, sz.height);
+#endif
+
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        // values are in [0, 255], so rounding to 11 (FP16) or 8 (BF16) bits of mantissa
+        // changes them by half a unit in the last place at most
+        EXPECT_LE(cv::norm(in_mat1, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
+
+namespace {
+// Known bit patterns are converted in a row long enough for both vector and scalar code of the kernels
+const int bitPatternRowSize = 37;
+
+uint32_t convertFromF16(uint16_t h, bool bf16) {
+    cv::Mat in_mat(1, bitPatternRowSize, CV_16UC1, cv::Scalar::all(h));
+    cv::Mat out_mat(1, bitPatternRowSize, CV_32FC1);
+    ConvertFromF16Computation cc(to_test(in_mat), to_test(out_mat), bf16);
+    cc.warmUp();
+
+    uint32_t u;
+    std::memcpy(&u, out_mat.ptr<float>(0), sizeof(u));
+    for (int x = 1; x < bitPatternRowSize; x++)
+        EXPECT_EQ(0, std::memcmp(&u, out_mat.ptr<float>(0) + x, sizeof(u))) << "position " << x;
+    return u;
+}
+
+uint16_t convertToF16(uint32_t u, bool bf16) {
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    cv::Mat in_mat(1, bitPatternRowSize, CV_32FC1, cv::Scalar::all(f));
+    cv::Mat out_mat(1, bitPatternRowSize, CV_16UC1);
+    ConvertToF16Computation cc(to_test(in_mat), to_test(out_mat), bf16);
+    cc.warmUp();
+
+    const uint16_t h = out_mat.at<uint16_t>(0, 0);
+    for (int x = 1; x < bitPatternRowSize; x++)
+        EXPECT_EQ(h, out_mat.at<uint16_t>(0, x)) << "position " << x;
+    return h;
+}
+
+bool isF16NaN(uint16_t h, bool bf16) {
+    return bf16 ? (h & 0x7f80u) == 0x7f80u && (h & 0x007fu) : (h & 0x7c00u) == 0x7c00u && (h & 0x03ffu);
+}
+}  // anonymous namespace
+
+TEST(ConvertF16BitPatternTest, FP16ToFloat)
+{
+    const std::vector<std::pair<uint16_t, uint32_t>> patterns = {
+        {0x0000, 0x00000000}, {0x8000, 0x80000000},  // zeros
+        {0x0001, 0x33800000}, {0x8001, 0xb3800000},  // smallest denormal
+        {0x03ff, 0x387fc000},                        // largest denormal
+        {0x0400, 0x38800000},                        // smallest normal
+        {0x3c00, 0x3f800000}, {0xc000, 0xc0000000},
+        {0x7bff, 0x477fe000},                        // largest normal
+        {0x7c00, 0x7f800000}, {0xfc00, 0xff800000},  // infinities
+    };
+    for (const auto &p : patterns)
+        EXPECT_EQ(p.second, convertFromF16(p.first, false)) << std::hex << "0x" << p.first;
+
+    for (uint16_t nan : {0x7e00, 0x7c01, 0xffff}) {
+        const uint32_t u = convertFromF16(nan, false);
+        EXPECT_TRUE((u & 0x7f800000u) == 0x7f800000u && (u & 0x007fffffu)) << std::hex << "0x" << nan;
+    }
+}
+
+TEST(ConvertF16BitPatternTest, FloatToFP16)
+{
+    const std::vector<std::pair<uint32_t, uint16_t>> patterns = {
+        {0x00000000, 0x0000}, {0x80000000, 0x8000},
+        {0x33800000, 0x0001},                        // smallest denormal
+        {0x33000000, 0x0000},                        // tie between 0 and the smallest denormal: to even
+        {0x33000001, 0x0001},                        // above the tie
+        {0x33c00000, 0x0002},                        // tie between denormals 1 and 2: to even
+        {0x387fc000, 0x03ff},                        // largest denormal
+        {0x387fe000, 0x0400},                        // tie between the largest denormal and the smallest normal
+        {0x3f800000, 0x3c00},
+        {0x3f801000, 0x3c00},                        // tie between 0x3c00 and 0x3c01: to even
+        {0x3f801001, 0x3c01},                        // above the tie
+        {0x3f803000, 0x3c02},                        // tie between 0x3c01 and 0x3c02: to even
+        {0x477fe000, 0x7bff},                        // largest normal
+        {0x477fefff, 0x7bff},                        // below the tie with infinity
+        {0x477ff000, 0x7c00},                        // tie with infinity: overflow
+        {0x7f7fffff, 0x7c00}, {0xff7fffff, 0xfc00},  // overflow
+        {0x7f800000, 0x7c00}, {0xff800000, 0xfc00},  // infinities
+        {0x2edbe6ff, 0x0000},                        // underflow
+    };
+    for (const auto &p : patterns)
+        EXPECT_EQ(p.second, convertToF16(p.first, false)) << std::hex << "0x" << p.first;
+
+    for (uint32_t nan : {0x7fc00000u, 0x7f800001u, 0xffffffffu})
+        EXPECT_TRUE(isF16NaN(convertToF16(nan, false), false)) << std::hex << "0x" << nan;
+}
+
+TEST(ConvertF16BitPatternTest, BF16ToFloat)
+{
+    for (uint16_t h : {0x0000, 0x8000, 0x0001, 0x007f, 0x0080, 0x3f80, 0xc000, 0x7f7f, 0x7f80, 0xff80})
+        EXPECT_EQ(static_cast<uint32_t>(h) << 16, convertFromF16(h, true)) << std::hex << "0x" << h;
+
+    for (uint16_t nan : {0x7fc0, 0x7f81, 0xffff}) {
+        const uint32_t u = convertFromF16(nan, true);
+        EXPECT_TRUE((u & 0x7f800000u) == 0x7f800000u && (u & 0x007fffffu)) << std::hex << "0x" << nan;
+    }
+}
+
+TEST(ConvertF16BitPatternTest, FloatToBF16)
+{
+    const std::vector<std::pair<uint32_t, uint16_t>> patterns = {
+        {0x00000000, 0x0000}, {0x80000000, 0x8000},
+        {0x00000001, 0x0000},                        // denormal is rounded to zero
+        {0x00010000, 0x0001},                        // smallest denormal
+        {0x3f800000, 0x3f80},
+        {0x3f808000, 0x3f80},                        // tie between 0x3f80 and 0x3f81: to even
+        {0x3f808001, 0x3f81},                        // above the tie
+        {0x3f818000, 0x3f82},                        // tie between 0x3f81 and 0x3f82: to even
+        {0x3f80ffff, 0x3f81},
+        {0x7f7f8000, 0x7f80},                        // tie with infinity: overflow
+        {0x7f7fffff, 0x7f80},                        // overflow
+        {0x7f800000, 0x7f80}, {0xff800000, 0xff80},  // infinities
+    };
+    for (const auto &p : patterns)
+        EXPECT_EQ(p.second, convertToF16(p.first, true)) << std::hex << "0x" << p.first;
+
+    // signaling NaN must not become infinity when its payload is truncated
+    for (uint32_t nan : {0x7fc00000u, 0x7f800001u, 0xff800001u, 0xffffffffu})
+        EXPECT_TRUE(isF16NaN(convertToF16(nan, true), true)) << std::hex << "0x" << nan;
+}
+
+TEST_P(ResizeF16TestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    Precision in_prc, out_prc;
+    int interp = 0;
+    cv::Size sz_in, sz_out;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(in_prc, out_prc, interp, sizes, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    // integers in [0, 255] are exact in FP16 and BF16, so OpenCV resizes the same input
+    cv::Mat in_mat_u8(sz_in, CV_8UC3);
+    cv::randu(in_mat_u8, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::Mat in_mat;
+    in_mat_u8.convertTo(in_mat, CV_32F);
+
+    const bool in_f16 = in_prc == Precision::FP16 || in_prc == Precision::BF16;
+    const bool out_f16 = out_prc == Precision::FP16 || out_prc == Precision::BF16;
+    cv::Mat in_mat_ie = in_f16 ? convertF16(in_mat, in_prc == Precision::BF16) : in_mat;
+    cv::Mat out_mat_ie(sz_out, out_f16 ? CV_16UC3 : CV_32FC3);
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    const size_t channels = 3;
+    TensorDesc  in_desc(in_prc,  {1, channels, size_t(sz_in.height),  size_t(sz_in.width)},  Layout::NHWC);
+    TensorDesc out_desc(out_prc, {1, channels, size_t(sz_out.height), size_t(sz_out.width)}, Layout::NHWC);
+
+    Blob::Ptr in_blob  = make_blob_with_precision(in_desc, in_mat_ie.data);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc, out_mat_ie.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR);
+    preprocess->execute(out_blob, info, false);
+
+    cv::Mat out_mat = out_f16 ? convertF16(out_mat_ie, out_prc == Precision::BF16) : out_mat_ie;
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    cv::Mat out_mat_ocv;
+    cv::resize(in_mat, out_mat_ocv, sz_out, 0, 0, interp);
+
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
+    }
+}
+
 //----------------------------------------------------------------------
 
 TEST_P(ResizeTestIE, AccuracyTest)
@@ -735,6 +976,68 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST(PreprocEngineCacheTest, EvictsLeastRecentlyUsedGraphs)
+{
+    using namespace InferenceEngine;
+    const size_t capacity = 8;
+    const size_t inputs_num = capacity + 2;
+    const cv::Size sz_out(20, 16);
+
+    std::vector<cv::Mat> in_mats(inputs_num);
+    for (size_t i = 0; i < inputs_num; i++) {
+        in_mats[i].create(cv::Size(32 + 8 * i, 24 + 4 * i), CV_8UC3);
+        cv::randu(in_mats[i], cv::Scalar::all(0), cv::Scalar::all(255));
+    }
+
+    auto resize = [&](PreprocEngineComputation &engine, size_t idx) -> cv::Mat {
+        cv::Mat out_mat(sz_out, CV_8UC3);
+        auto &in_mat = in_mats[idx];
+        TensorDesc  in_desc(Precision::U8, {1, 3, size_t(in_mat.rows), size_t(in_mat.cols)}, Layout::NHWC);
+        TensorDesc out_desc(Precision::U8, {1, 3, size_t(sz_out.height), size_t(sz_out.width)}, Layout::NHWC);
+        Blob::Ptr in_blob = make_blob_with_precision(in_desc, in_mat.data);
+        Blob::Ptr out_blob = make_blob_with_precision(out_desc, out_mat.data);
+        engine.apply(in_blob, out_blob, RESIZE_BILINEAR);
+        return out_mat;
+    };
+
+    // a hit runs the graphs compiled for the input as they are, a miss compiles them or
+    // reshapes the least recently used ones, either way the result is the same as of a new engine
+    PreprocEngineComputation engine(capacity);
+    auto check = [&](size_t idx, bool hit) {
+        const size_t hits = engine.cacheHits(), misses = engine.cacheMisses();
+        PreprocEngineComputation reference_engine(capacity);
+        cv::Mat out_mat_ref = resize(reference_engine, idx);
+        cv::Mat out_mat = resize(engine, idx);
+
+        EXPECT_EQ(0, cv::norm(out_mat_ref, out_mat, cv::NORM_INF)) << "input " << idx;
+        EXPECT_EQ(hits + (hit ? 1 : 0), engine.cacheHits()) << "input " << idx;
+        EXPECT_EQ(misses + (hit ? 0 : 1), engine.cacheMisses()) << "input " << idx;
+    };
+
+    for (size_t i = 0; i < capacity; i++)
+        check(i, false);
+    for (size_t i = 0; i < capacity; i++)
+        check(i, true);
+
+    // most recent first: 7 6 5 4 3 2 1 0
+    check(8, false);    // 8 7 6 5 4 3 2 1
+    check(7, true);     // 7 8 6 5 4 3 2 1
+    check(0, false);    // 0 7 8 6 5 4 3 2
+    check(2, true);     // 2 0 7 8 6 5 4 3
+    check(1, false);    // 1 2 0 7 8 6 5 4
+    check(3, false);    // 3 1 2 0 7 8 6 5
+    check(5, true);     // 5 3 1 2 0 7 8 6
+
+    // cycling through more inputs than the cache holds evicts every entry before its next use
+    PreprocEngineComputation cycled_engine(capacity);
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < inputs_num; i++)
+            resize(cycled_engine, i);
+    }
+    EXPECT_EQ(0u, cycled_engine.cacheHits());
+    EXPECT_EQ(2 * inputs_num, cycled_engine.cacheMisses());
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
@@ -930,6 +1233,93 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
     }
 }
 
+TEST_P(BatchedROIResizeTestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    auto in_fmt = ColorFormat::RAW;
+    int interp = 0;
+    cv::Size out_size;
+    double tolerance = 0.0;
+    std::tie(in_fmt, interp, out_size, tolerance) = GetParam();
+
+    const cv::Size size(320, 240);
+    cv::Mat in_mat_y(size, CV_8UC1);
+    cv::Mat in_mat_uv(cv::Size(size.width / 2, size.height / 2), CV_8UC2);
+    cv::Mat in_mat(size, CV_8UC3);
+    cv::Scalar mean = cv::Scalar::all(127);
+    cv::Scalar stddev = cv::Scalar::all(40.f);
+
+    cv::randn(in_mat_y, mean, stddev);
+    cv::randn(in_mat_uv, mean / 2, stddev / 2);
+    cv::randn(in_mat, mean, stddev);
+
+    Blob::Ptr in_blob;
+    switch (in_fmt) {
+    case ColorFormat::NV12:
+        in_blob = make_shared_blob<NV12Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_uv, Layout::NHWC));
+        break;
+    case ColorFormat::I420: {
+        cv::Mat in_mat_u(cv::Size(size.width / 2, size.height / 2), CV_8UC1);
+        cv::Mat in_mat_v(cv::Size(size.width / 2, size.height / 2), CV_8UC1);
+        std::array<cv::Mat, 2> in_uv = {in_mat_u, in_mat_v};
+        cv::split(in_mat_uv, in_uv);
+        in_blob = make_shared_blob<I420Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_u, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_v, Layout::NHWC));
+        break;
+    }
+    default:
+        in_blob = img2Blob<Precision::U8>(in_mat, Layout::NHWC);
+        break;
+    }
+
+    // ROIs smaller and larger than the output in one or both dimensions, so AREA resize
+    // switches between its upscale and downscale graphs within the batch.
+    // All of them are taken from the only image of the batch.
+    const std::vector<ROI> rois = {
+        {0,   0,   0, 320, 240},
+        {0,  10,  20,  32,  24},
+        {0, 100,  50,  64,  48},
+        {0, 200, 120, 100,  90},
+        {0,   2, 200,  16,  30},
+        {0, 150,  10, 120,  20},
+        {0,  40,  60, 256, 176},
+    };
+
+    const size_t channels = 3;
+    const size_t slot_size = channels * out_size.height * out_size.width;
+    TensorDesc out_desc(Precision::U8, {rois.size(), channels, size_t(out_size.height), size_t(out_size.width)},
+                        Layout::NHWC);
+    auto out_blob = make_shared_blob<uint8_t>(out_desc);
+    out_blob->allocate();
+
+    PreProcessInfo info;
+    info.setColorFormat(in_fmt);
+    info.setResizeAlgorithm(cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR);
+
+    Blob::Ptr out_batch = out_blob;
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(make_shared_blob<BatchedROIBlob>(in_blob, rois));
+    preprocess->execute(out_batch, info, false);
+
+    // every batch slot is the same as the ROI resized alone
+    for (size_t i = 0; i < rois.size(); i++) {
+        TensorDesc out_roi_desc(Precision::U8, {1, channels, size_t(out_size.height), size_t(out_size.width)},
+                                Layout::NHWC);
+        Blob::Ptr out_roi_blob = make_shared_blob<uint8_t>(out_roi_desc);
+        out_roi_blob->allocate();
+
+        PreProcessDataPtr roi_preprocess = CreatePreprocDataHelper();
+        roi_preprocess->setRoiBlob(in_blob->createROI(rois[i]));
+        roi_preprocess->execute(out_roi_blob, info, false);
+
+        cv::Mat out_mat(out_size, CV_8UC3, out_blob->buffer().as<uint8_t*>() + i * slot_size);
+        cv::Mat out_mat_roi(out_size, CV_8UC3, out_roi_blob->buffer().as<uint8_t*>());
+        EXPECT_LE(cv::norm(out_mat_roi, out_mat, cv::NORM_INF), tolerance) << "ROI " << i;
+    }
+}
+
 TEST_P(SplitTestIE, AccuracyTest)
 {
     const auto params = GetParam();
@@ -25,10 +25,23 @@ struct ConvertDepthTestGAPI: public TestParams<std::tuple<
                             cv::Size,
                             double>>   // tolerance
 {};
+struct ConvertF16TestGAPI: public TestParams<std::tuple<
+                            InferenceEngine::Precision,  // FP16 or BF16
+                            cv::Size,
+                            double>>   // tolerance
+{};
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
 
+struct ResizeF16TestIE: public testing::TestWithParam<std::tuple<
+                            InferenceEngine::Precision,  // input precision
+                            InferenceEngine::Precision,  // output precision
+                            int,                         // interpolation
+                            std::pair<cv::Size, cv::Size>,
+                            double>>                     // tolerance
+{};
+
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 
@@ -48,6 +61,13 @@ struct ColorConvertYUV420TestIE:
                                              double>>                       // tolerance
 {};
 
+struct BatchedROIResizeTestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,  // input color format RAW, NV12 or I420
+                                             int,                           // interpolation
+                                             cv::Size,                      // output size
+                                             double>>                       // tolerance
+{};
+
 struct PrecisionConvertTestIE: public TestParams<std::tuple<cv::Size,
                                                             int,     // input  matrix depth
                                                             int,     // output matrix depth
@@ -183,6 +183,14 @@ INSTANTIATE_TEST_CASE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                                        cv::Size( 320,  200)),
                                 Values(1)));
 
+INSTANTIATE_TEST_CASE_P(ConvertF16Fluid, ConvertF16TestGAPI,
+                        Combine(Values(InferenceEngine::Precision::FP16, InferenceEngine::Precision::BF16),
+                                Values(cv::Size(1920, 1080),
+                                       cv::Size( 640,  480),
+                                       cv::Size( 300,  300),
+                                       cv::Size(  13,    7)),
+                                Values(0.5)));
+
 INSTANTIATE_TEST_CASE_P(ResizeRoiTestFluid, ResizeRoiTestGAPI,
                         Combine(Values(CV_8UC1, CV_8UC3),
                                 Values(cv::INTER_LINEAR),
@@ -225,6 +233,28 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+// resize error of FP32 plus rounding of the output to half a unit in the last place of values up to 255
+INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F16, ResizeF16TestIE,
+                        Combine(Values(InferenceEngine::Precision::FP16, InferenceEngine::Precision::FP32),
+                                Values(InferenceEngine::Precision::FP16),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(0.05 + 0.0625)));
+
+INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F16In, ResizeF16TestIE,
+                        Combine(Values(InferenceEngine::Precision::FP16, InferenceEngine::Precision::BF16),
+                                Values(InferenceEngine::Precision::FP32),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(0.05)));
+
+INSTANTIATE_TEST_CASE_P(ResizeTestFluid_BF16, ResizeF16TestIE,
+                        Combine(Values(InferenceEngine::Precision::BF16, InferenceEngine::Precision::FP32),
+                                Values(InferenceEngine::Precision::BF16),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(0.05 + 0.5)));
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
@@ -268,6 +298,12 @@ INSTANTIATE_TEST_CASE_P(ColorConvertYUV420Fluid, ColorConvertYUV420TestIE,
                                        cv::Size( 150,  150)),
                                 Values(0)));
 
+INSTANTIATE_TEST_CASE_P(BatchedROIResizeFluid, BatchedROIResizeTestIE,
+                        Combine(Values(InferenceEngine::RAW, InferenceEngine::NV12, InferenceEngine::I420),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::Size(64, 48), cv::Size(224, 224)),
+                                Values(0)));
+
 INSTANTIATE_TEST_CASE_P(Reorder_HWC2CHW, ColorConvertTestIE,
                         Combine(Values(CV_8U, CV_32F),
                                 Values(InferenceEngine::ColorFormat::BGR),
@@ -5,6 +5,7 @@
 #include <fluid_test_computations.hpp>
 #include <opencv2/gapi.hpp>
 #include <ie_preprocess_gapi_kernels.hpp>
+#include <ie_preprocess_gapi.hpp>
 #include <opencv2/gapi/fluid/gfluidkernel.hpp>
 
 #define CV_MAT_CHANNELS(flags) (((flags) >> CV_CN_SHIFT) + 1)
@@ -225,3 +226,60 @@ ConvertDepthComputation::ConvertDepthComputation(test::Mat inMat, test::Mat outM
                                })
 {}
 
+ConvertF16RoundTripComputation::ConvertF16RoundTripComputation(test::Mat inMat, test::Mat outMat, bool bf16)
+    : FluidComputation(new Priv{ [bf16]()-> cv::GComputation {
+                                    const int format = bf16 ? InferenceEngine::gapi::BF16 : InferenceEngine::gapi::FP16;
+                                    cv::GMat in;
+                                    cv::GMat f16 = InferenceEngine::gapi::ConvertToF16::on(in, format);
+                                    cv::GMat out = InferenceEngine::gapi::ConvertFromF16::on(f16, format);
+                                    return cv::GComputation(cv::GIn(in), cv::GOut(out));
+                                 }()
+                               , {to_own(inMat)}
+                               , {to_own(outMat)}
+                               })
+{}
+
+ConvertFromF16Computation::ConvertFromF16Computation(test::Mat inMat, test::Mat outMat, bool bf16)
+    : FluidComputation(new Priv{ [bf16]()-> cv::GComputation {
+                                    const int format = bf16 ? InferenceEngine::gapi::BF16 : InferenceEngine::gapi::FP16;
+                                    cv::GMat in;
+                                    cv::GMat out = InferenceEngine::gapi::ConvertFromF16::on(in, format);
+                                    return cv::GComputation(cv::GIn(in), cv::GOut(out));
+                                 }()
+                               , {to_own(inMat)}
+                               , {to_own(outMat)}
+                               })
+{}
+
+ConvertToF16Computation::ConvertToF16Computation(test::Mat inMat, test::Mat outMat, bool bf16)
+    : FluidComputation(new Priv{ [bf16]()-> cv::GComputation {
+                                    const int format = bf16 ? InferenceEngine::gapi::BF16 : InferenceEngine::gapi::FP16;
+                                    cv::GMat in;
+                                    cv::GMat out = InferenceEngine::gapi::ConvertToF16::on(in, format);
+                                    return cv::GComputation(cv::GIn(in), cv::GOut(out));
+                                 }()
+                               , {to_own(inMat)}
+                               , {to_own(outMat)}
+                               })
+{}
+
+
+PreprocEngineComputation::PreprocEngineComputation(size_t cacheCapacity)
+    : m_engine(std::make_shared<InferenceEngine::PreprocEngine>(cacheCapacity))
+{}
+
+void PreprocEngineComputation::apply(const InferenceEngine::Blob::Ptr &inBlob, InferenceEngine::Blob::Ptr &outBlob,
+                                     InferenceEngine::ResizeAlgorithm algorithm)
+{
+    m_engine->preprocessWithGAPI(inBlob, outBlob, algorithm, InferenceEngine::ColorFormat::RAW, false);
+}
+
+size_t PreprocEngineComputation::cacheHits() const
+{
+    return m_engine->cacheHits();
+}
+
+size_t PreprocEngineComputation::cacheMisses() const
+{
+    return m_engine->cacheMisses();
+}
@@ -6,6 +6,8 @@
 #define FLUID_TEST_COMPUTATIONS_HPP
 
 #include <ie_api.h>
+#include <ie_blob.h>
+#include <ie_preprocess.hpp>
 
 #include <memory>
 #include <vector>
@@ -104,4 +106,42 @@ public:
     ConvertDepthComputation(test::Mat inMat, test::Mat outMat, int depth);
 };
 
+class FLUID_COMPUTATION_VISIBILITY ConvertF16RoundTripComputation : public FluidComputation
+{
+public:
+    // FP32 -> FP16 (or BF16) -> FP32
+    ConvertF16RoundTripComputation(test::Mat inMat, test::Mat outMat, bool bf16);
+};
+
+class FLUID_COMPUTATION_VISIBILITY ConvertFromF16Computation : public FluidComputation
+{
+public:
+    // FP16 (or BF16) -> FP32, 16-bit data is passed in CV_16U matrix
+    ConvertFromF16Computation(test::Mat inMat, test::Mat outMat, bool bf16);
+};
+
+class FLUID_COMPUTATION_VISIBILITY ConvertToF16Computation : public FluidComputation
+{
+public:
+    // FP32 -> FP16 (or BF16), 16-bit data is passed in CV_16U matrix
+    ConvertToF16Computation(test::Mat inMat, test::Mat outMat, bool bf16);
+};
+
+namespace InferenceEngine
+{
+class PreprocEngine;
+}
+
+// Runs PreprocEngine directly, so the cache of its compiled graphs can be observed
+class FLUID_COMPUTATION_VISIBILITY PreprocEngineComputation
+{
+    std::shared_ptr<InferenceEngine::PreprocEngine> m_engine;
+public:
+    explicit PreprocEngineComputation(size_t cacheCapacity);
+    void apply(const InferenceEngine::Blob::Ptr &inBlob, InferenceEngine::Blob::Ptr &outBlob,
+               InferenceEngine::ResizeAlgorithm algorithm);
+    size_t cacheHits() const;
+    size_t cacheMisses() const;
+};
+
 #endif // FLUID_TEST_COMPUTATIONS_HPP
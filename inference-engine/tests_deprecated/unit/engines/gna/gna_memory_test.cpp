@@ -436,4 +436,70 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+
+TEST_F(GNAMemoryTest, canReuseMemoryOfRequestsWithDisjointLifetimes) {
+    float *pFuture = nullptr;
+    float *pFuture2 = nullptr;
+    float *pFuture3 = nullptr;
+    float *pInput2 = nullptr;
+    float *pInput3 = nullptr;
+
+    size_t len = 3 * sizeof(float);
+
+    mem.reserve_ptr(&pFuture, len);
+    mem.reserve_ptr(&pFuture2, len);
+    mem.reserve_ptr(&pFuture3, len);
+    mem.bind_ptr(&pInput2, &pFuture);
+    mem.bind_ptr(&pInput3, &pFuture2);
+
+    mem.setMemoryUsage({{&pFuture, 0, true},
+                        {&pInput2, 1, false}, {&pFuture2, 1, true},
+                        {&pInput3, 2, false}, {&pFuture3, 2, true}});
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 2 * len);
+    ASSERT_EQ(pFuture3, pFuture);
+    ASSERT_EQ(pFuture2, pFuture + 3);
+    ASSERT_EQ(pInput2, pFuture);
+    ASSERT_EQ(pInput3, pFuture2);
+}
+
+TEST_F(GNAMemoryTest, canNotReuseMemoryOfRequestReadBeforeWritten) {
+    float *pFuture = nullptr;
+    float *pFuture2 = nullptr;
+
+    size_t len = 3 * sizeof(float);
+
+    mem.reserve_ptr(&pFuture, len);
+    mem.reserve_ptr(&pFuture2, len);
+
+    // first request keeps state between inferences
+    mem.setMemoryUsage({{&pFuture, 0, false}, {&pFuture, 0, true},
+                        {&pFuture2, 1, true}});
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 2 * len);
+    ASSERT_EQ(pFuture2, pFuture + 3);
+}
+
+TEST_F(GNAMemoryTest, canNotReuseMemoryOfRequestWithUnknownUsage) {
+    float input[] = {1, 2, 3};
+    float *pFuture = nullptr;
+    float *pFuture2 = nullptr;
+    float *pFuture3 = nullptr;
+
+    size_t len = sizeof(input);
+
+    mem.reserve_ptr(&pFuture, len);
+    mem.push_ptr(&pFuture2, input, len);
+    mem.reserve_ptr(&pFuture3, len);
+
+    mem.setMemoryUsage({{&pFuture2, 1, false}, {&pFuture3, 2, true}});
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 3 * len);
+    ASSERT_EQ(pFuture2, pFuture + 3);
+    ASSERT_EQ(pFuture3, pFuture + 6);
+    ASSERT_FLOAT_EQ(pFuture2[0], 1);
+}